@@ -6,8 +6,174 @@
 #define EMULATOR_MOS_6502_ALU_HPP
 #include "StatusRegister.hpp"
 #include <cstdint>
+#include <limits>
+#include <utility>
 
 namespace emulator::mos_6502::ALU {
+namespace internal {
+/**
+ * @brief Convert a binary-represented decimal to its value
+ *
+ * The binary representation of a decimal works as follows:
+ * - the first four bits carry the high binary digits,
+ * - the last four bits carry the low binary digit.
+ * Thus, an 8-bit binary integer can represent decimals from 0 to 99 inclusively.
+ *
+ * For example, binary 0b01111001 represents a decimal 79, and a binary 0b00010100 represents a decimal 14.
+ * Therefore, the function returns {7, 9} and {1, 4} correspondingly.
+ *
+ * A digit may also be an invalid one from 10 to 15, which the arithmetic below handles as the NMOS 6502 does.
+ */
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> decode_decimal(const uint8_t binary) noexcept {
+    const uint8_t low_digit  = binary & 0x0f;
+    const uint8_t high_digit = (binary & 0xf0) >> 4;
+    return { high_digit, low_digit };
+}
+
+/**
+ * @brief Encode two decimal digits into a binary 8-bit number
+ *
+ * @copydetails decode_decimal
+ */
+[[nodiscard]] constexpr uint8_t encode_decimal(const uint8_t high_digit, const uint8_t low_digit) noexcept {
+    return static_cast<uint8_t>((high_digit & 0x0f) << 4 | (low_digit & 0x0f));
+}
+
+/**
+ * @brief Add two decimal digits with carry
+ *
+ * A sum above 9 is adjusted by adding 6, which wraps the digit around and produces the carry.
+ * For valid digits, it is the same as taking the sum modulo 10.
+ * For invalid digits in range [10, 15], the result is the same as of the NMOS 6502 hardware.
+ *
+ * @param[in] a The first digit
+ * @param[in] b The second digit
+ * @param[in, out] carry Is added to the result. Is then set if the result is greater than 9 and reset otherwise.
+ *
+ * @return The adjusted sum of the digits modulo 16
+ */
+[[nodiscard]] constexpr uint8_t add_decimal_digits(const uint8_t a, const uint8_t b, bool &carry) noexcept {
+    const auto result = a + b + carry;
+    carry             = result > 9;
+    return static_cast<uint8_t>((carry ? result + 6 : result) & 0x0f);
+}
+
+/**
+ * @brief Add two binary-coded unsigned decimal 8-bit integers with carry
+ *
+ * Each of the operands is considered to be a binary-codd decimal as described in @link decode_decimal @endlink.
+ *
+ * @param[in] a The first number
+ * @param[in] b The second number
+ * @param[in, out] carry Its initial value is added to the result.
+ *                       If the result is greater than 99, the carry is set, and reset otherwise.
+ *
+ * @return Binary-coded decimal result modulo 100
+ */
+[[nodiscard]] constexpr uint8_t add_decimal(const uint8_t a, const uint8_t b, bool &carry) noexcept {
+    const auto [high_digit_a, low_digit_a] = decode_decimal(a);
+    const auto [high_digit_b, low_digit_b] = decode_decimal(b);
+
+    const auto low_digit_sum  = add_decimal_digits(low_digit_a, low_digit_b, carry);
+    const auto high_digit_sum = add_decimal_digits(high_digit_a, high_digit_b, carry);
+
+    return encode_decimal(high_digit_sum, low_digit_sum);
+}
+
+/**
+ * @brief Add two unsigned 8-bit integers with carry
+ *
+ * @param[in] a The first number
+ * @param[in] b The second number
+ * @param[in, out] carry Its initial value is added to the result.
+ *                       If the result is greater than 255, the carry is set, and reset otherwise.
+ *
+ * @return Potentially wrapped unsigned 8-bit result
+ *
+ * @post If the result is greater than 255, it is wrapped around zero.
+ */
+[[nodiscard]] constexpr uint8_t add_binary(const uint8_t a, const uint8_t b, bool &carry) noexcept {
+    const auto result = static_cast<uint16_t>(a) + static_cast<uint16_t>(b) + (carry ? uint16_t{ 1 } : uint16_t{ 0 });
+    carry = result > std::numeric_limits<uint8_t>::max();
+    return static_cast<uint8_t>(result);
+}
+
+/**
+ * @brief Subtract two unsigned 8-bit integers with borrow
+ *
+ * @param[in] a The number to subtract from
+ * @param[in] b The number to subtract
+ * @param[in, out] borrow Its initial value is subtracted the result.
+ *                        If the result is negative, the borrow is set, and reset otherwise.
+ *
+ * @return Unsigned 8-bit result modulo 256
+ */
+[[nodiscard]] constexpr uint8_t subtract_binary(const uint8_t a, const uint8_t b, bool &borrow) noexcept {
+    const auto result = static_cast<int>(a) - static_cast<int>(b) - (borrow ? 1 : 0);
+    borrow            = result < 0;
+    return static_cast<uint8_t>(result);
+}
+
+/**
+ * @brief Subtract two decimal digits with borrow
+ *
+ * A negative difference is adjusted by subtracting 6, which wraps the digit around.
+ * For valid digits, it is the same as taking the difference modulo 10.
+ * For invalid digits in range [10, 15], the result is the same as of the NMOS 6502 hardware.
+ *
+ * @param[in] a The digit to subtract from
+ * @param[in] b The digit to subtract
+ * @param[in, out] borrow Is subtracted from the result.
+ *                        Is then set if the result is negative and reset otherwise.
+ *
+ * @return The adjusted difference between the digits modulo 16
+ */
+[[nodiscard]] constexpr uint8_t subtract_decimal_digits(const uint8_t a, const uint8_t b, bool &borrow) noexcept {
+    const auto result = static_cast<int>(a) - static_cast<int>(b) - (borrow ? 1 : 0);
+    borrow            = result < 0;
+    return static_cast<uint8_t>((borrow ? result - 6 : result) & 0x0f);
+}
+
+/**
+ * @brief Subtract two binary-coded unsigned decimal 8-bit integers with borrow
+ *
+ * Each of the operands is considered to be a binary-codd decimal as described in @link decode_decimal @endlink.
+ *
+ * @param[in] a The number to subtract from
+ * @param[in] b The number to subtract
+ * @param[in, out] borrow Its initial value is subtracted from the result.
+ *                        If the result is negative, the carry is set, and reset otherwise.
+ *
+ * @return Binary-coded decimal result modulo 100
+ */
+[[nodiscard]] constexpr uint8_t subtract_decimal(const uint8_t a, const uint8_t b, bool &borrow) noexcept {
+    const auto [high_digit_a, low_digit_a] = decode_decimal(a);
+    const auto [high_digit_b, low_digit_b] = decode_decimal(b);
+
+    const auto low_digit_sum  = subtract_decimal_digits(low_digit_a, low_digit_b, borrow);
+    const auto high_digit_sum = subtract_decimal_digits(high_digit_a, high_digit_b, borrow);
+
+    return encode_decimal(high_digit_sum, low_digit_sum);
+}
+
+/**
+ * @brief Binary sum of the high digits of a decimal addition before they are adjusted
+ *
+ * The low digits are added and adjusted first, and their carry is added to the high digits.
+ * The NMOS 6502 sets the overflow flag of a decimal addition from this intermediate sum.
+ *
+ * @param[in] a The first number
+ * @param[in] b The second number
+ * @param[in] carry The initial carry
+ *
+ * @return Intermediate sum, whose low digit is not meaningful
+ */
+[[nodiscard]] constexpr uint8_t add_decimal_intermediate(const uint8_t a, const uint8_t b, bool carry) noexcept {
+    static_cast<void>(add_decimal_digits(a & 0x0f, b & 0x0f, carry));
+    return static_cast<uint8_t>((a & 0xf0) + (b & 0xf0) + (carry ? 0x10 : 0));
+}
+} // namespace internal
+
 /**
  * @brief Add two unsigned 8-bit integers with carry
  *
@@ -21,12 +187,25 @@ namespace emulator::mos_6502::ALU {
  * @post The status register is updated at the end of the operation.
  *       - The carry flag is set when the sum of a binary addition exceeds 255
  *         or when the sum of a decimal addition exceeds 99, otherwise it is reset.
- *       - The overflow flag is set whe the sign or bit 7 differs from that of the first value
- *         due to result exceeding +127 or -128, otherwise it is reset.
+ *       - The overflow flag is set when both values have the same sign and the sum has the other one,
+ *         i.e. the signed sum exceeds +127 or -128, otherwise it is reset.
+ *         In the decimal mode, the sum is the intermediate one of @link internal::add_decimal_intermediate
+ *         @endlink, as on the NMOS 6502.
  *       - The negative flag is set if the result contains bit 7 on, otherwise it is reset.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t add(uint8_t a, uint8_t b, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t add(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    bool carry        = sr.carry; // bit-field sr.carry cannot be used as an in-out boolean
+    const auto result = sr.decimal ? internal::add_decimal(a, b, carry) : internal::add_binary(a, b, carry);
+    const auto sum    = sr.decimal ? internal::add_decimal_intermediate(a, b, sr.carry) : result;
+
+    sr.carry    = carry;
+    sr.overflow = (~(a ^ b) & (a ^ sum) & 0x80) != 0; // The values have the same sign, and the sum has the other
+    sr.negative = result & 0x80;
+    sr.zero     = result == 0;
+
+    return result;
+}
 
 /**
  * @brief Add two unsigned 8-bit integers with borrow
@@ -44,11 +223,25 @@ namespace emulator::mos_6502::ALU {
  * @post The status register is updated at the end of the operation.
  *       - The carry flag is set if the result is greater than or equal to zero,
  *       otherwise it is reset indicating a borrow.
- *       - The overflow flag is set when the result exceeds +127 or -127, otherwise it is reset.
+ *       - The overflow flag is set when the values have different signs and the difference has the sign of
+ *         the second one, i.e. the signed difference exceeds +127 or -128, otherwise it is reset.
+ *         In the decimal mode, it is taken from the binary difference, as on the NMOS 6502.
  *       - The negative flag is set if the result has bit 7 on, otherwise it is reset.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t subtract(uint8_t a, uint8_t b, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t subtract(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    bool borrow           = !sr.carry;
+    bool binary_borrow    = borrow;
+    const auto difference = internal::subtract_binary(a, b, binary_borrow);
+    const auto result     = sr.decimal ? internal::subtract_decimal(a, b, borrow) : difference;
+
+    sr.carry    = sr.decimal ? !borrow : !binary_borrow;
+    sr.overflow = ((a ^ b) & (a ^ difference) & 0x80) != 0; // The values differ in sign, and a changed its sign
+    sr.negative = result & 0x80;
+    sr.zero     = result == 0;
+
+    return result;
+}
 
 /**
  * @brief AND two unsigned 8-bit integers
@@ -67,21 +260,39 @@ namespace emulator::mos_6502::ALU {
  *       - The negative flag is set if the result has bit 7 on, otherwise it is reset.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t logical_and(uint8_t a, uint8_t b, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t logical_and(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    const auto result = a & b;
+
+    sr.negative = result & 0x80;
+    sr.zero     = result == 0;
+    return static_cast<uint8_t>(result);
+}
 
 /**
  * @brief OR two unsigned 8-bit integers
  *
  * @copydoc logical_and
  */
-[[nodiscard]] uint8_t logical_or(uint8_t a, uint8_t b, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t logical_or(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    const auto result = a | b;
+
+    sr.negative = result & 0x80;
+    sr.zero     = result == 0;
+    return static_cast<uint8_t>(result);
+}
 
 /**
  * @brief XOR two unsigned 8-bit integers
  *
  * @copydoc logical_and
  */
-[[nodiscard]] uint8_t logical_xor(uint8_t a, uint8_t b, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t logical_xor(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    const auto result = a ^ b;
+
+    sr.negative = result & 0x80;
+    sr.zero     = result == 0;
+    return static_cast<uint8_t>(result);
+}
 
 /**
  * @brief Shift an unsigned 8-bit integer right one bit
@@ -94,7 +305,14 @@ namespace emulator::mos_6502::ALU {
  *       - The negative flag is always reset.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t shift_right(uint8_t a, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t shift_right(uint8_t a, StatusRegister &sr) noexcept {
+    sr.carry = a & 1; // store the rightmost bit
+    a >>= 1;
+
+    sr.negative = false;
+    sr.zero     = a == 0;
+    return a;
+}
 
 /**
  * @brief Shift an unsigned 8-bit integer left one bit
@@ -107,7 +325,14 @@ namespace emulator::mos_6502::ALU {
  *       - The negative flag is set to result bit 7 (input bit 6).
  *       - The zero flag is set if the result of the shift is zero and reset otherwise.
  */
-[[nodiscard]] uint8_t shift_left(uint8_t a, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t shift_left(uint8_t a, StatusRegister &sr) noexcept {
+    sr.carry = a & 0x80; // store the leftmost bit
+    a <<= 1;
+
+    sr.negative = a & 0x80;
+    sr.zero     = a == 0;
+    return a;
+}
 
 /**
  * @brief Rotate an unsigned 8-bit integer left one bit
@@ -125,7 +350,16 @@ namespace emulator::mos_6502::ALU {
  *       - The negative flag is set equal to input bit 6.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t rotate_left(uint8_t a, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t rotate_left(uint8_t a, StatusRegister &sr) noexcept {
+    const bool output_carry = a & 0x80; // store the leftmost bit
+    a <<= 1;
+    if (sr.carry) a |= 1; // set the rightmost bit
+
+    sr.carry    = output_carry;
+    sr.negative = a & 0x80;
+    sr.zero     = a == 0;
+    return a;
+}
 
 /**
  * @brief Rotate an unsigned 8-bit integer right one bit
@@ -143,7 +377,90 @@ namespace emulator::mos_6502::ALU {
  *       - The negative flag is set equal to input carry.
  *       - The zero flag is set if the result is zero, otherwise it is reset.
  */
-[[nodiscard]] uint8_t rotate_right(uint8_t a, StatusRegister &sr) noexcept;
+[[nodiscard]] constexpr uint8_t rotate_right(uint8_t a, StatusRegister &sr) noexcept {
+    const bool output_carry = a & 1; // store the rightmost bit
+    a >>= 1;
+    if (sr.carry) a |= 0x80; // set the leftmost bit
+
+    sr.carry    = output_carry;
+    sr.negative = a & 0x80;
+    sr.zero     = a == 0;
+    return a;
+}
+
+/**
+ * @brief Increment an unsigned 8-bit integer by one
+ *
+ * @param[in] a The number to be incremented
+ * @param[out] sr Does not affect the operation. Some of its flags are set as a result.
+ *
+ * @return Unsigned 8-bit result modulo 256
+ *
+ * @post The status register is updated at the end of the operation.
+ *       - The negative flag is set if the result has bit 7 on, otherwise it is reset.
+ *       - The zero flag is set if the result is zero, otherwise it is reset.
+ */
+[[nodiscard]] constexpr uint8_t increment(uint8_t a, StatusRegister &sr) noexcept {
+    ++a;
+
+    sr.negative = a & 0x80;
+    sr.zero     = a == 0;
+    return a;
+}
+
+/**
+ * @brief Decrement an unsigned 8-bit integer by one
+ *
+ * @copydetails increment
+ */
+[[nodiscard]] constexpr uint8_t decrement(uint8_t a, StatusRegister &sr) noexcept {
+    --a;
+
+    sr.negative = a & 0x80;
+    sr.zero     = a == 0;
+    return a;
+}
+
+/**
+ * @brief Compare two unsigned 8-bit integers
+ *
+ * The comparison is performed as a binary subtraction without borrow whose result is discarded.
+ * The decimal flag does not affect it.
+ *
+ * @param[in] a The register value
+ * @param[in] b The memory value
+ * @param[out] sr Does not affect the operation. Some of its flags are set as a result.
+ *
+ * @post The status register is updated at the end of the operation.
+ *       - The carry flag is set if @p a is greater than or equal to @p b, otherwise it is reset.
+ *       - The negative flag is set equal to bit 7 of the difference.
+ *       - The zero flag is set if the values are equal, otherwise it is reset.
+ */
+constexpr void compare(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    const auto difference = static_cast<uint8_t>(a - b);
+
+    sr.carry    = a >= b;
+    sr.negative = difference & 0x80;
+    sr.zero     = a == b;
+}
+
+/**
+ * @brief Test bits of a memory value against the accumulator
+ *
+ * @param[in] a The accumulator value
+ * @param[in] b The memory value
+ * @param[out] sr Does not affect the operation. Some of its flags are set as a result.
+ *
+ * @post The status register is updated at the end of the operation.
+ *       - The negative flag is set equal to bit 7 of @p b.
+ *       - The overflow flag is set equal to bit 6 of @p b.
+ *       - The zero flag is set if @p a AND @p b is zero, otherwise it is reset.
+ */
+constexpr void test_bits(const uint8_t a, const uint8_t b, StatusRegister &sr) noexcept {
+    sr.negative = b & 0x80;
+    sr.overflow = b & 0x40;
+    sr.zero     = (a & b) == 0;
+}
 } // namespace emulator::mos_6502::ALU
 
 #endif //EMULATOR_MOS_6502_ALU_HPP
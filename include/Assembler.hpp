@@ -0,0 +1,429 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_ASSEMBLER_HPP
+#define EMULATOR_MOS_6502_ASSEMBLER_HPP
+#include "Memory.hpp"
+#include "Opcode.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Two-pass 6502 assembler that runs at compile time
+ *
+ * The source has a statement per line, and everything after a semicolon is a comment:
+ * @code{text}
+ * counter = $10          ; a symbol
+ *         .org $0200     ; where the next bytes go
+ * start:  LDX #<count    ; a label, followed by an instruction
+ * loop:   DEC counter,X
+ *         BNE loop
+ *         JMP (vector)
+ * vector: .word start, $1234
+ *         .byte 1, 2, %101
+ * @endcode
+ *
+ * The mnemonics and the register names are case-insensitive, the symbols are not.
+ * An expression is a sum or a difference of numbers, symbols and @p * for the current address,
+ * optionally preceded by @p < or @p > to take its low or high byte. The numbers are decimal,
+ * hexadecimal after @p $ or binary after @p %.
+ *
+ * Every mode of @link Addressing @endlink is written as usual, @p A stands for the accumulator.
+ * A memory operand uses the zero-page form of the instruction if its value is known to fit into a byte
+ * when the statement is reached. Symbols defined further down are not known yet, so they get the absolute form.
+ */
+class Assembler {
+public:
+    /// @brief Outcome of an assembly
+    struct Result {
+        Memory::Data image{};   ///< Zeroed memory with the assembled bytes
+        std::string_view error; ///< Description of the first error, empty on success
+        size_t line = 0;        ///< Line of the error, counting from one
+    };
+
+    /// @brief Maximal number of labels and symbols in a source
+    static constexpr size_t max_symbols = 256;
+
+    /**
+     * @brief Assemble a source, either at compile time or at run time
+     */
+    [[nodiscard]] static constexpr Result assemble(const std::string_view source) noexcept {
+        Assembler assembler{ source };
+        assembler.pass(false);
+        if (assembler._result.error.empty()) assembler.pass(true);
+        return assembler._result;
+    }
+
+    /**
+     * @brief Assemble a source at compile time, so that any error in it fails the build
+     */
+    [[nodiscard]] static consteval Memory::Data image(const std::string_view source) {
+        const auto result = assemble(source);
+        if (!result.error.empty()) invalid_source(result.error, result.line);
+        return result.image;
+    }
+
+private:
+    /// @brief Label or symbol defined by an assignment
+    struct Symbol {
+        std::string_view name;
+        int value   = 0;
+        size_t line = 0;     ///< Line of the definition
+        bool exact  = false; ///< Whether the value was known in the first pass
+    };
+
+    /// @brief Value of an expression
+    struct Value {
+        int value  = 0;
+        bool known = true; ///< Whether only the symbols defined above with exact values are involved
+    };
+
+    /// @brief Number of the addressing modes
+    static constexpr size_t modes = static_cast<size_t>(Addressing::ZeroPageY) + 1;
+
+    /// @brief Number of the instructions
+    static constexpr size_t instructions = static_cast<size_t>(Instruction::TYA) + 1;
+
+    using Encodings = std::array<std::array<std::optional<uint8_t>, modes>, instructions>;
+
+    /// @brief Opcode of every instruction in every addressing mode, inverted from the decoder
+    [[nodiscard]] static constexpr Encodings encodings() noexcept {
+        Encodings result{};
+        for (unsigned opcode = 0; opcode < 0x100; ++opcode) {
+            const auto instruction = getInstruction(static_cast<uint8_t>(opcode));
+            const auto addressing  = getAddressing(static_cast<uint8_t>(opcode));
+            if (instruction && addressing)
+                result[static_cast<size_t>(*instruction)][static_cast<size_t>(*addressing)] =
+                    static_cast<uint8_t>(opcode);
+        }
+        return result;
+    }
+
+    /**
+     * @brief Reports an error of a compile-time assembly: being not @p constexpr, it stops the compilation
+     */
+    static void invalid_source(std::string_view, size_t) noexcept {}
+
+    constexpr explicit Assembler(const std::string_view source) noexcept : _source(source) {}
+
+    [[nodiscard]] static constexpr bool is_space(const char c) noexcept { return c == ' ' || c == '\t' || c == '\r'; }
+
+    [[nodiscard]] static constexpr bool is_identifier(const char c, const bool first) noexcept {
+        return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || c == '_' || (!first && c >= '0' && c <= '9');
+    }
+
+    [[nodiscard]] static constexpr char upper(const char c) noexcept {
+        return c >= 'a' && c <= 'z' ? static_cast<char>(c - 'a' + 'A') : c;
+    }
+
+    [[nodiscard]] static constexpr std::string_view trim(std::string_view text) noexcept {
+        while (!text.empty() && is_space(text.front())) text.remove_prefix(1);
+        while (!text.empty() && is_space(text.back())) text.remove_suffix(1);
+        return text;
+    }
+
+    /// @brief Take the identifier at the start of a text
+    [[nodiscard]] static constexpr std::string_view identifier(const std::string_view text) noexcept {
+        size_t length = 0;
+        while (length < text.size() && is_identifier(text[length], length == 0)) ++length;
+        return text.substr(0, length);
+    }
+
+    /// @brief Whether a text names a register, case-insensitively
+    [[nodiscard]] static constexpr bool is_register(const std::string_view text, const char name) noexcept {
+        return text.size() == 1 && upper(text.front()) == name;
+    }
+
+    [[nodiscard]] static constexpr std::optional<Instruction> mnemonic(const std::string_view text) noexcept {
+        if (text.size() != 3) return std::nullopt;
+        for (size_t i = 0; i < instructions; ++i) {
+            const auto instruction = static_cast<Instruction>(i);
+            const auto name        = getMnemonic(instruction);
+            if (upper(text[0]) == name[0] && upper(text[1]) == name[1] && upper(text[2]) == name[2])
+                return instruction;
+        }
+        return std::nullopt;
+    }
+
+    [[nodiscard]] constexpr std::optional<uint8_t> opcode(const Instruction instruction,
+                                                          const Addressing addressing) const noexcept {
+        return _opcodes[static_cast<size_t>(instruction)][static_cast<size_t>(addressing)];
+    }
+
+    [[nodiscard]] static constexpr size_t operand_size(const Addressing addressing) noexcept {
+        switch (addressing) {
+        case Addressing::Accumulator:
+        case Addressing::Implicit: return 0;
+        case Addressing::Absolute:
+        case Addressing::AbsoluteX:
+        case Addressing::AbsoluteY:
+        case Addressing::Indirect: return 2;
+        default: return 1;
+        }
+    }
+
+    /// @brief Record the first error
+    constexpr void fail(const std::string_view error) noexcept {
+        if (!_result.error.empty()) return;
+        _result.error = error;
+        _result.line  = _line;
+    }
+
+    [[nodiscard]] constexpr bool failed() const noexcept { return !_result.error.empty(); }
+
+    constexpr void pass(const bool final) noexcept {
+        _final = final;
+        _pc    = 0;
+        _line  = 0;
+        for (size_t begin = 0; begin <= _source.size() && !failed();) {
+            auto end = _source.find('\n', begin);
+            if (end == std::string_view::npos) end = _source.size();
+            ++_line;
+            statement(_source.substr(begin, end - begin));
+            begin = end + 1;
+        }
+    }
+
+    constexpr void statement(std::string_view text) noexcept {
+        text = trim(text.substr(0, text.find(';')));
+        if (text.empty()) return;
+
+        auto name = identifier(text);
+        if (!name.empty()) {
+            const auto rest = trim(text.substr(name.size()));
+            if (!rest.empty() && rest.front() == '=') {
+                const auto value = expression(rest.substr(1));
+                define(name, value);
+                return;
+            }
+            if (!rest.empty() && rest.front() == ':') {
+                define(name, { .value = _pc, .known = true });
+                text = trim(rest.substr(1));
+                if (text.empty()) return;
+                name = identifier(text);
+            }
+        }
+
+        if (text.front() == '.') directive(text.substr(1));
+        else instruction(name, trim(text.substr(name.size())));
+    }
+
+    constexpr void define(const std::string_view name, const Value value) noexcept {
+        for (size_t i = 0; i < _count; ++i) {
+            auto &symbol = _symbols[i];
+            if (symbol.name != name) continue;
+            if (!_final) return fail("duplicate symbol");
+            symbol.value = value.value;
+            return;
+        }
+
+        if (_count == _symbols.size()) return fail("too many symbols");
+        _symbols[_count++] = { .name = name, .value = value.value, .line = _line, .exact = value.known };
+    }
+
+    /// @brief Evaluate a number, a symbol or the current address
+    [[nodiscard]] constexpr Value term(std::string_view &text) noexcept {
+        text = trim(text);
+        if (text.empty()) {
+            fail("missing operand");
+            return {};
+        }
+
+        if (text.front() == '*') {
+            text.remove_prefix(1);
+            return { .value = _pc };
+        }
+
+        if (is_identifier(text.front(), true)) {
+            const auto name = identifier(text);
+            text.remove_prefix(name.size());
+            for (size_t i = 0; i < _count; ++i)
+                if (_symbols[i].name == name)
+                    return { .value = _symbols[i].value, .known = _symbols[i].line < _line && _symbols[i].exact };
+            if (_final) fail("undefined symbol");
+            return { .known = false };
+        }
+
+        unsigned base = 10;
+        if (text.front() == '$' || text.front() == '%') {
+            base = text.front() == '$' ? 16 : 2;
+            text.remove_prefix(1);
+        }
+        int value     = 0;
+        size_t digits = 0;
+        for (; digits < text.size(); ++digits) {
+            const char c   = upper(text[digits]);
+            unsigned digit = base;
+            if (c >= '0' && c <= '9') digit = static_cast<unsigned>(c - '0');
+            else if (c >= 'A' && c <= 'F') digit = static_cast<unsigned>(c - 'A' + 10);
+            if (digit >= base) break;
+            value = value * static_cast<int>(base) + static_cast<int>(digit);
+            if (value > 0xFFFF) {
+                fail("number out of range");
+                return {};
+            }
+        }
+        if (digits == 0) fail("malformed number");
+        text.remove_prefix(digits);
+        return { .value = value };
+    }
+
+    /// @brief Evaluate a whole expression
+    [[nodiscard]] constexpr Value expression(std::string_view text) noexcept {
+        text = trim(text);
+        const char byte = !text.empty() && (text.front() == '<' || text.front() == '>') ? text.front() : '\0';
+        if (byte != '\0') text.remove_prefix(1);
+
+        auto result = term(text);
+        while (!failed()) {
+            text = trim(text);
+            if (text.empty()) break;
+            const char operation = text.front();
+            if (operation != '+' && operation != '-') {
+                fail("malformed expression");
+                break;
+            }
+            text.remove_prefix(1);
+            const auto next = term(text);
+            result.value    = operation == '+' ? result.value + next.value : result.value - next.value;
+            result.known    = result.known && next.known;
+        }
+
+        if (byte == '<') result.value &= 0xFF;
+        if (byte == '>') result.value = (result.value >> 8) & 0xFF;
+        return result;
+    }
+
+    constexpr void emit(const int byte) noexcept {
+        if (_final) _result.image[_pc] = static_cast<uint8_t>(byte);
+        _pc = static_cast<uint16_t>(_pc + 1);
+    }
+
+    /// @brief Emit a list of expressions separated by commas
+    constexpr void data(std::string_view text, const bool words) noexcept {
+        while (!failed()) {
+            const auto comma = text.find(',');
+            const auto value = expression(text.substr(0, comma));
+            if (_final && (value.value < 0 || value.value > (words ? 0xFFFF : 0xFF))) return fail("value out of range");
+            emit(value.value & 0xFF);
+            if (words) emit(value.value >> 8 & 0xFF);
+            if (comma == std::string_view::npos) return;
+            text.remove_prefix(comma + 1);
+        }
+    }
+
+    constexpr void directive(const std::string_view text) noexcept {
+        const auto name      = identifier(text);
+        const auto arguments = text.substr(name.size());
+        if (name == "org") {
+            const auto value = expression(arguments);
+            if (!value.known) return fail("origin must be known");
+            if (value.value < 0 || value.value > 0xFFFF) return fail("origin out of range");
+            _pc = static_cast<uint16_t>(value.value);
+        } else if (name == "byte") data(arguments, false);
+        else if (name == "word") data(arguments, true);
+        else fail("unknown directive");
+    }
+
+    constexpr void instruction(const std::string_view name, const std::string_view operand) noexcept {
+        const auto instruction = mnemonic(name);
+        if (!instruction) return fail("unknown mnemonic");
+        const auto supports = [this, instruction](const Addressing addressing) {
+            return opcode(*instruction, addressing).has_value();
+        };
+
+        Addressing addressing = Addressing::Implicit;
+        Value value;
+        if (operand.empty())
+            addressing = supports(Addressing::Implicit) ? Addressing::Implicit : Addressing::Accumulator;
+        else if (is_register(operand, 'A')) addressing = Addressing::Accumulator;
+        else if (operand.front() == '#') {
+            addressing = Addressing::Immediate;
+            value      = expression(operand.substr(1));
+        } else if (operand.front() == '(') {
+            const auto close = operand.find(')');
+            if (close == std::string_view::npos) return fail("malformed operand");
+            auto inside      = operand.substr(1, close - 1);
+            const auto after = trim(operand.substr(close + 1));
+            const auto comma = inside.rfind(',');
+            if (after.empty() && comma != std::string_view::npos && is_register(trim(inside.substr(comma + 1)), 'X')) {
+                addressing = Addressing::IndexedIndirect;
+                inside     = inside.substr(0, comma);
+            } else if (after.empty()) addressing = Addressing::Indirect;
+            else if (after.front() == ',' && is_register(trim(after.substr(1)), 'Y'))
+                addressing = Addressing::IndirectIndexed;
+            else return fail("malformed operand");
+            value = expression(inside);
+        } else {
+            auto address     = operand;
+            const auto comma = operand.rfind(',');
+            char index       = '\0';
+            if (comma != std::string_view::npos) {
+                const auto suffix = trim(operand.substr(comma + 1));
+                if (is_register(suffix, 'X')) index = 'X';
+                else if (is_register(suffix, 'Y')) index = 'Y';
+                else return fail("malformed operand");
+                address = operand.substr(0, comma);
+            }
+            value = expression(address);
+
+            const auto zero_page = index == 'X' ? Addressing::ZeroPageX
+                                 : index == 'Y' ? Addressing::ZeroPageY
+                                                : Addressing::ZeroPage;
+            const auto absolute  = index == 'X' ? Addressing::AbsoluteX
+                                 : index == 'Y' ? Addressing::AbsoluteY
+                                                : Addressing::Absolute;
+            if (index == '\0' && supports(Addressing::Relative)) addressing = Addressing::Relative;
+            else if (!supports(absolute)
+                     || (value.known && value.value >= 0 && value.value <= 0xFF && supports(zero_page)))
+                addressing = zero_page;
+            else addressing = absolute;
+        }
+        if (failed()) return;
+
+        const auto code = opcode(*instruction, addressing);
+        if (!code) return fail("unsupported addressing mode");
+        emit(*code);
+
+        if (addressing == Addressing::Relative) {
+            const auto offset = value.value - (_pc + 1);
+            if (_final && (offset < -128 || offset > 127)) return fail("branch out of range");
+            emit(offset & 0xFF);
+            return;
+        }
+
+        const auto size = operand_size(addressing);
+        if (_final && (value.value < 0 || value.value > (size == 2 ? 0xFFFF : 0xFF)))
+            return fail("operand out of range");
+        if (size >= 1) emit(value.value & 0xFF);
+        if (size == 2) emit(value.value >> 8 & 0xFF);
+    }
+
+    std::string_view _source;
+
+    /// @brief Built for every assembly, since a constant of the class cannot be computed within it
+    Encodings _opcodes = encodings();
+
+    Result _result;
+
+    std::array<Symbol, max_symbols> _symbols{};
+
+    size_t _count = 0;
+
+    /// @brief Address of the next byte
+    uint16_t _pc = 0;
+
+    /// @brief Current line, counting from one
+    size_t _line = 0;
+
+    /// @brief Whether the pass emits the bytes, the first one only computes the addresses of the labels
+    bool _final = false;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_ASSEMBLER_HPP
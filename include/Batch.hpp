@@ -0,0 +1,123 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_BATCH_HPP
+#define EMULATOR_MOS_6502_BATCH_HPP
+#include "CPU.hpp"
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Executor of many independent CPU instances on a fixed pool of threads
+ *
+ * Instead of occupying a thread until it finishes, an instance is executed in slices of a fixed number of cycles.
+ * Every worker keeps a queue of the instances it owns: it takes a slice from the back of its own queue
+ * and puts the instance back unless it finished.
+ * A worker that ran out of instances steals them from the front of the queues of the others,
+ * so the load stays balanced even if the instances need very different numbers of cycles.
+ * A worker that finds no instance to steal sleeps until another one puts an instance back or finishes one.
+ */
+class Batch {
+public:
+    /// @brief Final state of an instance
+    struct Result {
+        CPU::Registers registers;
+        size_t cycles = 0;     ///< Number of cycles executed by the batch
+        bool stopped  = false; ///< Whether it stopped before the budget was spent, see @link CPU::run @endlink
+    };
+
+    /**
+     * @param threads Number of workers. Zero means the number of hardware threads.
+     * @param slice Number of cycles executed by an instance before the worker may switch to another one
+     * @throws std::bad_alloc If the queues cannot be allocated
+     */
+    explicit Batch(unsigned threads = 0, size_t slice = 10'000);
+
+    /**
+     * @brief Add an instance to be executed by the next @link run @endlink
+     *
+     * @param cpu The instance, ready to be executed
+     * @param budget Number of cycles to execute
+     * @return Index of the instance in the results
+     */
+    size_t add(std::unique_ptr<CPU> cpu, size_t budget);
+
+    /**
+     * @brief Execute all the added instances and wait for them to finish
+     *
+     * @return Results indexed as the instances
+     * @throws std::bad_alloc If a worker runs out of memory, which stops all of them
+     */
+    [[nodiscard]] std::vector<Result> run();
+
+    /**
+     * @brief Access an instance, e.g. to inspect its memory after the execution
+     */
+    [[nodiscard]] const CPU &instance(size_t index) const noexcept;
+
+    /**
+     * @brief Number of the added instances
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+private:
+    /// @brief Instance with its progress
+    struct Task {
+        std::unique_ptr<CPU> cpu;
+        size_t start = 0; ///< Cycle of the instance when it was added
+        size_t end   = 0; ///< Cycle at which the budget is spent
+        bool stopped = false;
+    };
+
+    /// @brief Queue of task indices owned by a worker
+    struct Queue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    /**
+     * @brief Execute the tasks until all of them finish
+     *
+     * The first exception is kept for @link run @endlink to rethrow, and it stops all the workers.
+     *
+     * @param worker Index of the queue owned by the calling thread
+     */
+    void work(size_t worker) noexcept;
+
+    /**
+     * @brief Take a task from the own queue, or steal one from another queue
+     *
+     * @return Index of the task, or @link Task @endlink count if all the queues are empty
+     */
+    [[nodiscard]] size_t take(size_t worker) noexcept;
+
+    std::vector<Task> _tasks;
+
+    std::vector<std::unique_ptr<Queue>> _queues;
+
+    /// @brief Number of tasks that did not finish yet, including those being executed
+    std::atomic<size_t> _remaining = 0;
+
+    /// @brief Changes whenever a task is put back or finishes, so that the idle workers can wait for it
+    std::atomic<uint64_t> _version = 0;
+
+    /// @brief Whether a worker failed, so that the others stop
+    std::atomic<bool> _failed = false;
+
+    std::mutex _failure_mutex;
+
+    /// @brief First exception thrown by a worker
+    std::exception_ptr _failure;
+
+    size_t _slice;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_BATCH_HPP
@@ -0,0 +1,130 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_BREAKPOINTS_HPP
+#define EMULATOR_MOS_6502_BREAKPOINTS_HPP
+#include "Memory.hpp"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Execution breakpoints and memory watchpoints
+ *
+ * Every memory access of the CPU is filtered by a bitmap with a single bit per page and kind of access.
+ * Only accesses to pages with at least one breakpoint or watchpoint of the same kind go through the detailed check,
+ * so that setting a watchpoint does not slow down the accesses to all the other pages.
+ *
+ * - A breakpoint (@link Access::Execute @endlink) stops the CPU before the instruction at its address is executed.
+ *   Stepping again executes the instruction, so that the execution can be resumed.
+ * - A watchpoint (@link Access::Read @endlink or @link Access::Write @endlink) stops the CPU after the instruction
+ *   that accessed its address is completed.
+ *
+ * Both can be restricted to a value: the opcode for breakpoints, the value read or written for watchpoints.
+ */
+class Breakpoints {
+public:
+    /// @brief The access that stopped the CPU
+    struct Hit {
+        Access access;    ///< Kind of the triggered breakpoint or watchpoint
+        uint16_t address; ///< Accessed address
+        uint8_t value;    ///< The opcode for breakpoints, the value read or written for watchpoints
+    };
+
+    /**
+     * @brief Add a breakpoint or a watchpoint
+     *
+     * @param value If set, only accesses of this value trigger it
+     */
+    void add(Access access, uint16_t address, std::optional<uint8_t> value = std::nullopt);
+
+    /**
+     * @brief Remove all the breakpoints or watchpoints of a kind at an address
+     */
+    void remove(Access access, uint16_t address) noexcept;
+
+    /**
+     * @brief Remove all the breakpoints and watchpoints
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Check whether any breakpoint or watchpoint of a kind lies on the page of an address
+     */
+    [[nodiscard]] bool watched(const Access access, const uint16_t address) const noexcept {
+        const auto page = address >> 8;
+        return (_pages[static_cast<size_t>(access)][page >> 6] >> (page & 63) & 1) != 0;
+    }
+
+    /**
+     * @brief Check whether any watchpoint on reads or writes is set
+     */
+    [[nodiscard]] bool watches_memory() const noexcept {
+        for (const auto access : { Access::Read, Access::Write })
+            for (const auto pages : _pages[static_cast<size_t>(access)])
+                if (pages != 0) return true;
+        return false;
+    }
+
+    /**
+     * @brief Check a memory access against the watchpoints
+     *
+     * Only the accesses to watched pages leave the fast path.
+     */
+    void check(const Access access, const uint16_t address, const uint8_t value) noexcept {
+        if (watched(access, address)) [[unlikely]]
+            match(access, address, value);
+    }
+
+    /**
+     * @brief Forget the hit of the previous step, before the CPU takes an interrupt or executes an instruction
+     */
+    void clear_hit() noexcept { _hit.reset(); }
+
+    /**
+     * @brief Check the breakpoints before the next instruction
+     *
+     * @retval true If the instruction must not be executed
+     */
+    [[nodiscard]] bool before_instruction(uint16_t pc, uint8_t opcode) noexcept;
+
+    /**
+     * @brief The breakpoint or watchpoint triggered by the last instruction
+     */
+    [[nodiscard]] const std::optional<Hit> &hit() const noexcept;
+
+private:
+    struct Entry {
+        Access access;
+        uint16_t address;
+        std::optional<uint8_t> value;
+    };
+
+    /**
+     * @brief Find an entry matching an access to a watched page and remember the hit
+     */
+    void match(Access access, uint16_t address, uint8_t value) noexcept;
+
+    /**
+     * @brief Recompute the filter bit of a page after its entries changed
+     */
+    void update_page(Access access, uint16_t address) noexcept;
+
+    /// @brief Filter bitmaps with one bit per page, indexed by the kind of access
+    std::array<std::array<uint64_t, 4>, 3> _pages{};
+
+    /// @brief All the breakpoints and watchpoints, there are usually just a few of them
+    std::vector<Entry> _entries;
+
+    /// @brief The triggered breakpoint or watchpoint
+    std::optional<Hit> _hit;
+
+    /// @brief Address of the breakpoint the CPU has stopped at, so that it is passed when resumed
+    std::optional<uint16_t> _resumed;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_BREAKPOINTS_HPP
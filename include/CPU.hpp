@@ -4,21 +4,43 @@
 
 #ifndef EMULATOR_MOS_6502_CPU_HPP
 #define EMULATOR_MOS_6502_CPU_HPP
+#include "Breakpoints.hpp"
 #include "Clock.hpp"
+#include "Core.hpp"
+#include "Coverage.hpp"
+#include "Guard.hpp"
+#include "HostCall.hpp"
 #include "Memory.hpp"
+#include "Profiler.hpp"
+#include "Scheduler.hpp"
+#include "WriteLog.hpp"
+#include <array>
 #include <atomic>
 
 namespace emulator::mos_6502 {
-class CPU {
+class Journal;
+
+/**
+ * @brief The 6502 with its clock, memory, devices and observers
+ *
+ * The instructions themselves are executed by @link Core @endlink, every bus cycle of which goes through the clock,
+ * the guard, the observers and either a device or the memory.
+ */
+class CPU : public Core<CPU> {
 public:
     /**
-     * @brief Reset vector
+     * @brief State of the CPU and its memory at an instruction boundary
      *
-     * At this address in ROM lies the initial value of the PC register.
+     * The interrupt lines, the devices and the observers are outside the CPU, so they are not included.
      */
-    static constexpr uint16_t RES = 0xFFFC;
+    struct Snapshot {
+        Registers registers;
+        size_t cycle    = 0;
+        bool irq_masked = false; ///< The interrupt-disable flag as seen by the interrupt polling
+        Memory memory;
+    };
 
-    explicit CPU(std::chrono::nanoseconds clock_period, const Memory &memory) noexcept;
+    explicit CPU(std::chrono::nanoseconds clock_period, const Memory &memory);
 
     /**
      * @brief Start the CPU
@@ -32,6 +54,42 @@ public:
      */
     void reset() noexcept;
 
+    /**
+     * @brief Execute a single instruction
+     *
+     * Every memory access of the instruction, including the dummy ones performed by the real hardware,
+     * takes one clock cycle.
+     *
+     * The interrupt lines are sampled at instruction boundaries only.
+     * If an interrupt is pending, the 7-cycle interrupt sequence is performed instead of the instruction,
+     * so that the first instruction of the handler is executed by the next call.
+     * Like in the hardware, the change of the interrupt-disable flag by CLI, SEI and PLP only affects
+     * the boundary after the next instruction.
+     *
+     * @retval true If the instruction was executed.
+     * @retval false If the opcode at PC is illegal and no host call is registered for it.
+     *               The CPU is then jammed: PC keeps pointing at the opcode, so every further call fails as well.
+     * @retval false If a breakpoint or a watchpoint was hit, see @link Breakpoints @endlink.
+     * @retval false If the guard denied an access, see @link Guard @endlink.
+     *               If it was the fetch of the opcode, PC keeps pointing at it.
+     */
+    bool step() noexcept;
+
+    /**
+     * @brief Execute instructions until a cycle budget is spent
+     *
+     * Unlike @link start @endlink, it neither resets the CPU nor blocks until the termination,
+     * so that the execution can be resumed by the next call, possibly from another thread.
+     * The budget is checked at instruction boundaries, so it may be exceeded by up to 7 cycles,
+     * or by the cycles a host call returns, see @link set_host_call @endlink.
+     *
+     * @param cycles Budget of the slice
+     * @retval true If the budget was spent.
+     * @retval false If the execution stopped earlier, either because @link step @endlink failed
+     *               or because of the termination.
+     */
+    bool run(size_t cycles) noexcept;
+
     /**
      * @brief Terminate the execution of the CPU
      *
@@ -39,59 +97,242 @@ public:
      */
     void terminate() noexcept;
 
+    /**
+     * @brief Pull the interrupt request line low on behalf of a device
+     *
+     * The line is level-triggered and shared by up to 32 devices, each of which is identified by its own bit.
+     * The interrupt is requested as long as any device keeps asserting it.
+     * It is designed to be called from any thread, including the one running the CPU.
+     *
+     * @param source Index of the device in range [0, 31]
+     */
+    void assert_irq(unsigned source) noexcept;
+
+    /**
+     * @brief Stop asserting the interrupt request line on behalf of a device
+     *
+     * @copydetails assert_irq
+     */
+    void release_irq(unsigned source) noexcept;
+
+    /**
+     * @brief Generate a falling edge on the non-maskable interrupt line
+     *
+     * The interrupt is taken once per edge, regardless of the interrupt-disable flag.
+     * It is designed to be called from any thread, including the one running the CPU.
+     */
+    void trigger_nmi() noexcept;
+
     /**
      * @brief Estimated clock frequency
      */
     [[nodiscard]] double frequency() const noexcept;
 
+    /**
+     * @brief The number of clock cycles elapsed since the construction
+     */
+    [[nodiscard]] size_t cycle() const noexcept;
+
+    /**
+     * @brief The interrupt-disable flag as seen by the interrupt polling, which lags behind CLI, SEI and PLP
+     */
+    [[nodiscard]] bool irq_masked() const noexcept;
+
+    /**
+     * @brief Hash of the registers and the memory, computed in constant time
+     *
+     * The cycle count is not included, so that the same state reached by different paths has the same digest.
+     *
+     * @see Memory::digest
+     */
+    [[nodiscard]] uint64_t digest() const noexcept;
+
+    /**
+     * @brief Overwrite the registers, including the interrupt-disable flag seen by the interrupt polling
+     */
+    void set_registers(const Registers &registers) noexcept;
+
+    /**
+     * @brief Report every executed instruction to a profiler
+     *
+     * @param profiler Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_profiler(Profiler *profiler) noexcept;
+
+    /**
+     * @brief Mark every memory access in coverage bitmaps
+     *
+     * @param coverage Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_coverage(Coverage *coverage) noexcept;
+
+    /**
+     * @brief Mark the control flow edges taken by branches, jumps, returns and interrupts
+     *
+     * @param edges Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_edge_coverage(EdgeCoverage *edges) noexcept;
+
+    /**
+     * @brief Stop at breakpoints and watchpoints
+     *
+     * @param breakpoints Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches them.
+     */
+    void set_breakpoints(Breakpoints *breakpoints) noexcept;
+
+    /**
+     * @brief Emulate devices alongside the CPU
+     *
+     * The accesses to the I/O pages of the scheduler go to the devices, which are synchronized with the cycle of
+     * the access first. The events of the scheduler are delivered at instruction boundaries.
+     *
+     * @param scheduler Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_scheduler(Scheduler *scheduler) noexcept;
+
+    /**
+     * @brief Check every memory access against permissions and stop at the first denied one
+     *
+     * @param guard Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_guard(Guard *guard) noexcept;
+
+    /**
+     * @brief Record the external events into a journal or replay them from it
+     *
+     * @param journal Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_journal(Journal *journal) noexcept;
+
+    /**
+     * @brief Log every memory write, indexed by the address
+     *
+     * @param write_log Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     */
+    void set_write_log(WriteLog *write_log) noexcept;
+
+    /**
+     * @brief Invoke a native routine whenever an illegal opcode is executed, instead of jamming
+     *
+     * The trap takes the cycle of the opcode fetch and the cycles returned by the routine.
+     * It is reported to the profiler as an instruction of its own and to the edge coverage as a jump.
+     * The routine accesses the memory directly, so the trap is not taken while anything that has to see its writes
+     * is attached: a coverage, a guard, a write log, a watchpoint on reads or writes, or a scheduler mapping a page.
+     * The CPU then stops at it as at any other illegal opcode.
+     *
+     * @param opcode Any opcode for which @link getInstruction @endlink returns @p std::nullopt, e.g. 0x02
+     * @param host_call Must outlive the CPU or be detached before destruction. Passing @p nullptr detaches it.
+     *
+     * @retval false If the opcode is a legal one, so nothing is registered.
+     */
+    bool set_host_call(uint8_t opcode, HostCall *host_call) noexcept;
+
+    /**
+     * @brief Execute the canonical block copy and fill loops of the guest as single native operations
+     *
+     * A loop is recognized when PC reaches its first instruction, in either of the forms
+     * @code{text}
+     * loop: LDA (src),Y
+     *       STA (dst),Y
+     *       INY
+     *       BNE loop
+     * @endcode
+     * or the same without the load, which fills the memory with A. The rest of the loop then runs at once,
+     * ending in the same registers and memory and taking the exact number of cycles of its instructions.
+     * The writes go through @link Memory::write @endlink, so the ROM is kept intact.
+     *
+     * The loop is executed instruction by instruction as usual if any observer, guard or journal is attached,
+     * if a scheduler event falls within it, if it would run past the budget of @link run @endlink,
+     * if it touches an I/O page, or if it overwrites its own code or pointers.
+     * An interrupt requested while the loop runs is taken after it.
+     */
+    void set_loop_acceleration(bool enabled) noexcept;
+
+    /**
+     * @brief Capture the state between two instructions
+     */
+    [[nodiscard]] Snapshot snapshot() const;
+
+    /**
+     * @brief Return to a captured state, including the cycle count
+     */
+    void restore(const Snapshot &snapshot);
+
     /**
      * @brief Get a view of the CPU's memory
      */
     [[nodiscard]] const Memory &memory() const & noexcept;
 
     /**
-     * @brief Get a copy of the CPU's memory
+     * @brief Get the CPU's memory, e.g. to load a program or to restore it between runs
+     *
+     * @warning It must not be modified while the CPU is running.
+     */
+    [[nodiscard]] Memory &memory() & noexcept;
+
+    /**
+     * @brief Take the CPU's memory, after which the CPU must not be used
      */
     [[nodiscard]] Memory &&memory() && noexcept;
 
 private:
+    friend class Core<CPU>;
+
     /**
-     * @brief Construct a 16-bit unsigned integer from two 8-bit unsigned integers
+     * @brief Read a byte from a specified address of the memory
+     *
+     * @pre Waits until the next high pulse arrives from @link _clock @endlink.
      *
-     * @param high High byte of the result
-     * @param low Low byte of the result
+     * @post Increments the cycle count.
      */
-    [[nodiscard]] static uint16_t make_word(uint8_t high, uint8_t low) noexcept;
+    uint8_t bus_read(uint16_t address) noexcept;
 
     /**
-     * @brief Read a byte from a specified address of the memory
+     * @brief Read a byte from the device mapped at an address, or from the memory if there is none
+     *
+     * @pre The scheduler is attached.
+     */
+    [[nodiscard]] uint8_t read_device(uint16_t address) noexcept;
+
+    /**
+     * @brief Read a byte of the instruction stream
+     *
+     * @copydetails bus_read
+     */
+    uint8_t bus_fetch(uint16_t address) noexcept;
+
+    /**
+     * @brief Write a byte to a specified address of the memory
+     *
+     * Writes to the ROM still take a cycle, but have no effect.
      *
      * @pre Waits until the next high pulse arrives from @link _clock @endlink.
      *
      * @post Increments the cycle count.
      */
-    uint8_t read(uint16_t address) noexcept;
+    void bus_write(uint16_t address, uint8_t value) noexcept;
 
     /**
-     * @brief Program counter
+     * @brief Execute a single instruction without running a native loop past a cycle
      *
-     * The program counter keeps track of the memory location holding the current instruction code.
-     * Its content is automatically stepped up as the program is executed and is modified by branch and jump operations.
-     * As it must be able to address the full 16-bit address range of 64K bytes, it's the only 16-bit register of the
-     * 6502.
+     * @param end Cycle at which the budget of @link run @endlink is spent
      */
-    uint16_t PC = 0;
+    bool step(size_t end) noexcept;
 
     /**
-     * @brief Stack pointer
+     * @brief Run the rest of a block copy or fill loop starting at PC natively
      *
-     * The stack pointer points to the current top of stack, or rather, to its bottom, as the stack grows top-down.
-     * The processor stack is located on memory page #1 ($0100–$01FF), 256 bytes Last-In-First-Out (LIFO) stack,
-     * which enables subroutines and also serves as a quick intermediate storage.
-     * As an 8-bit register, the stack pointer holds just the low-byte of this address (the offset from $0100.)
-     * Be aware that this just wraps around in case that the stack underflows.
+     * @param limit Cycle the loop may not run past, so that it is executed instruction by instruction instead
+     * @retval false If there is no such loop or it cannot be accelerated, so nothing was executed.
      */
-    uint8_t SP = 0;
+    [[nodiscard]] bool accelerate_loop(size_t limit) noexcept;
+
+    /**
+     * @brief Perform the interrupt sequence if any of the interrupt lines requires it
+     *
+     * @retval true If an interrupt was taken
+     */
+    [[nodiscard]] bool poll_interrupts() noexcept;
 
     /**
      * @brief Pulse generator of the CPU.
@@ -103,6 +344,45 @@ private:
     /// @brief Memory used by the CPU
     Memory _memory;
 
+    /// @brief Optional observer of the executed instructions
+    Profiler *_profiler = nullptr;
+
+    /// @brief Optional bitmaps of the accessed addresses
+    Coverage *_coverage = nullptr;
+
+    /// @brief Optional bitmap of the control flow edges
+    EdgeCoverage *_edges = nullptr;
+
+    /// @brief Optional breakpoints and watchpoints
+    Breakpoints *_breakpoints = nullptr;
+
+    /// @brief Optional devices and their events
+    Scheduler *_scheduler = nullptr;
+
+    /// @brief Optional memory access permissions
+    Guard *_guard = nullptr;
+
+    /// @brief Optional record or replay of the external events
+    Journal *_journal = nullptr;
+
+    /// @brief Optional log of the memory writes
+    WriteLog *_write_log = nullptr;
+
+    /// @brief Optional native routines invoked by the illegal opcodes, indexed by the opcode
+    std::array<HostCall *, 256> _host_calls{};
+
+    /// @brief Devices asserting the interrupt request line, one bit per device
+    std::atomic<uint32_t> _irq_lines = 0;
+
+    /// @brief If @p true, an edge on the non-maskable interrupt line is yet to be served
+    std::atomic<bool> _nmi_edge = false;
+
+    /// @brief The value of the interrupt-disable flag as seen by the interrupt polling at the next boundary
+    bool _irq_masked = false;
+
+    /// @brief Whether the block copy and fill loops are executed natively
+    bool _accelerate_loops = false;
+
     /// @brief If @p true, the CPU must stop after completing the current operation
     std::atomic_flag _terminate = false;
 
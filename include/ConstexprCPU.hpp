@@ -0,0 +1,107 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_CONSTEXPR_CPU_HPP
+#define EMULATOR_MOS_6502_CONSTEXPR_CPU_HPP
+#include "Core.hpp"
+#include "Memory.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief The 6502 without a clock, devices or observers, which runs programs in constant evaluation
+ *
+ * It executes the instructions with the same @link Core @endlink as @link CPU @endlink, bus cycle by bus cycle,
+ * over a plain array of bytes. All the memory is RAM, and there are no interrupt lines.
+ * Tables and expected results are then computed by running 6502 code inside the compiler:
+ * @code
+ * constexpr auto squares = [] {
+ *     ConstexprCPU cpu{ Assembler::image(source) };
+ *     cpu.reset();
+ *     cpu.run(100'000);
+ *     return cpu.memory();
+ * }();
+ * @endcode
+ */
+class ConstexprCPU : public Core<ConstexprCPU> {
+public:
+    constexpr explicit ConstexprCPU(const Memory::Data &memory) noexcept : _memory(memory) {}
+
+    /**
+     * @brief Reset the CPU to its initial state
+     */
+    constexpr void reset() noexcept { Core::reset(); }
+
+    /**
+     * @brief Execute a single instruction
+     *
+     * @retval true If the instruction was executed.
+     * @retval false If the opcode at PC is illegal, which leaves PC pointing at it.
+     */
+    constexpr bool step() noexcept {
+        const auto opcode      = fetch();
+        const auto instruction = getInstruction(opcode);
+        const auto addressing  = getAddressing(opcode);
+        if (!instruction || !addressing) {
+            --PC; // jam at the illegal opcode
+            return false;
+        }
+        execute(*instruction, *addressing);
+        return true;
+    }
+
+    /**
+     * @brief Execute instructions until a cycle budget is spent or the program jumps to itself
+     *
+     * A jump or a branch to itself is how the test programs end, see @link Trap @endlink.
+     *
+     * @retval true If the program reached a jump or a branch to itself.
+     * @retval false If the budget was spent or an illegal opcode was reached first.
+     */
+    constexpr bool run(const size_t cycles) noexcept {
+        const auto end = _cycle + cycles;
+        while (_cycle < end) {
+            const auto pc     = PC;
+            const auto opcode = _memory[pc];
+            if (!step()) return false;
+
+            const bool loops = getInstruction(opcode) == Instruction::JMP
+                           || getAddressing(opcode) == Addressing::Relative;
+            if (PC == pc && loops) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief The number of clock cycles elapsed since the construction
+     */
+    [[nodiscard]] constexpr size_t cycle() const noexcept { return _cycle; }
+
+    [[nodiscard]] constexpr const Memory::Data &memory() const noexcept { return _memory; }
+
+    [[nodiscard]] constexpr Memory::Data &memory() noexcept { return _memory; }
+
+private:
+    friend class Core<ConstexprCPU>;
+
+    constexpr uint8_t bus_read(const uint16_t address) noexcept {
+        ++_cycle;
+        return _memory[address];
+    }
+
+    constexpr uint8_t bus_fetch(const uint16_t address) noexcept { return bus_read(address); }
+
+    constexpr void bus_write(const uint16_t address, const uint8_t value) noexcept {
+        ++_cycle;
+        _memory[address] = value;
+    }
+
+    Memory::Data _memory;
+
+    size_t _cycle = 0;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_CONSTEXPR_CPU_HPP
@@ -0,0 +1,446 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_CORE_HPP
+#define EMULATOR_MOS_6502_CORE_HPP
+#include "ALU.hpp"
+#include "Opcode.hpp"
+#include "StatusRegister.hpp"
+#include <cstdint>
+#include <utility>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Snapshot of the programmer-visible registers
+ */
+struct Registers {
+    uint16_t PC = 0; ///< Program counter
+    uint8_t SP  = 0; ///< Stack pointer
+    uint8_t A   = 0; ///< Accumulator
+    uint8_t X   = 0; ///< Index register X
+    uint8_t Y   = 0; ///< Index register Y
+    StatusRegister SR;
+
+    constexpr bool operator==(const Registers &other) const noexcept {
+        return PC == other.PC && SP == other.SP && A == other.A && X == other.X && Y == other.Y
+            && SR.to_byte() == other.SR.to_byte();
+    }
+};
+
+/**
+ * @brief Registers and instruction semantics of the 6502, shared by every CPU whatever its bus
+ *
+ * The core performs every cycle of an instruction, including the dummy accesses of the hardware,
+ * through the bus of the derived class, which provides:
+ * - @p bus_read(address) for a data access, including the stack and the vectors,
+ * - @p bus_fetch(address) for a byte of the instruction stream,
+ * - @p bus_write(address, value).
+ *
+ * Everything is @p constexpr, so a CPU whose bus is @p constexpr as well executes programs in constant evaluation,
+ * see @link ConstexprCPU @endlink, while @link CPU @endlink runs the very same code with its clock and observers.
+ *
+ * @tparam Bus The derived class
+ */
+template <typename Bus>
+class Core {
+public:
+    /**
+     * @brief Reset vector
+     *
+     * At this address in ROM lies the initial value of the PC register.
+     */
+    static constexpr uint16_t RES = 0xFFFC;
+
+    /**
+     * @brief Non-maskable interrupt vector
+     *
+     * At this address in ROM lies the address of the non-maskable interrupt handler.
+     */
+    static constexpr uint16_t NMI = 0xFFFA;
+
+    /**
+     * @brief Interrupt request vector
+     *
+     * At this address in ROM lies the address of the maskable interrupt handler, which is also used by BRK.
+     */
+    static constexpr uint16_t IRQ = 0xFFFE;
+
+    using Registers = mos_6502::Registers;
+
+    /**
+     * @brief Get the current values of the registers
+     */
+    [[nodiscard]] constexpr Registers registers() const noexcept {
+        return { .PC = PC, .SP = SP, .A = A, .X = X, .Y = Y, .SR = SR };
+    }
+
+    /**
+     * @brief Overwrite the registers, e.g. to start execution at an arbitrary address
+     */
+    constexpr void set_registers(const Registers &registers) noexcept {
+        PC = registers.PC;
+        SP = registers.SP;
+        A  = registers.A;
+        X  = registers.X;
+        Y  = registers.Y;
+        SR = registers.SR;
+    }
+
+protected:
+    constexpr Core() noexcept = default;
+
+    /**
+     * @brief Construct a 16-bit unsigned integer from two 8-bit unsigned integers
+     *
+     * @param high High byte of the result
+     * @param low Low byte of the result
+     */
+    [[nodiscard]] static constexpr uint16_t make_word(const uint8_t high, const uint8_t low) noexcept {
+        return static_cast<uint16_t>(high) << 8 | static_cast<uint16_t>(low);
+    }
+
+    /// @brief Read a byte in a cycle of the bus
+    constexpr uint8_t read(const uint16_t address) noexcept { return bus().bus_read(address); }
+
+    /// @brief Read the next byte of the instruction stream and advance the program counter
+    constexpr uint8_t fetch() noexcept { return bus().bus_fetch(PC++); }
+
+    /// @brief Write a byte in a cycle of the bus
+    constexpr void write(const uint16_t address, const uint8_t value) noexcept { bus().bus_write(address, value); }
+
+    /// @brief Push a byte onto the stack
+    constexpr void push(const uint8_t value) noexcept { write(0x0100 | SP--, value); }
+
+    /// @brief Pull a byte from the stack
+    [[nodiscard]] constexpr uint8_t pull() noexcept { return read(0x0100 | ++SP); }
+
+    /**
+     * @brief Perform the reset sequence, which ends by loading PC from the reset vector
+     */
+    constexpr void reset() noexcept {
+        read(PC++);
+        read(PC++);
+        // The hardware performs three fake pushes, which are reads instead of writes
+        read(0x0100 + SP--);
+        read(0x0100 + SP--);
+        read(0x0100 + SP--);
+        SR.interrupt   = true;
+        const auto pcl = read(RES);
+        const auto pch = read(RES + 1);
+        PC             = make_word(pch, pcl);
+    }
+
+    /**
+     * @brief Push the state and jump to an interrupt handler
+     *
+     * @param vector Address of the handler address
+     * @param software If @p true, the break flag is set in the pushed status register
+     */
+    constexpr void interrupt(const uint16_t vector, const bool software) noexcept {
+        push(static_cast<uint8_t>(PC >> 8));
+        push(static_cast<uint8_t>(PC));
+        // The unused bit is always set when pushed, the break flag only if pushed by software
+        push(SR.to_byte() | (software ? 0x30 : 0x20));
+        SR.interrupt    = true;
+        const auto low  = read(vector);
+        const auto high = read(vector + 1);
+        PC              = make_word(high, low);
+    }
+
+    /**
+     * @brief Execute an instruction whose opcode has already been fetched
+     */
+    constexpr void execute(const Instruction instruction, const Addressing addressing) noexcept {
+        switch (instruction) {
+        case Instruction::ADC: A = ALU::add(A, load(addressing), SR); return;
+        case Instruction::SBC: A = ALU::subtract(A, load(addressing), SR); return;
+        case Instruction::AND: A = ALU::logical_and(A, load(addressing), SR); return;
+        case Instruction::ORA: A = ALU::logical_or(A, load(addressing), SR); return;
+        case Instruction::EOR: A = ALU::logical_xor(A, load(addressing), SR); return;
+        case Instruction::CMP: ALU::compare(A, load(addressing), SR); return;
+        case Instruction::CPX: ALU::compare(X, load(addressing), SR); return;
+        case Instruction::CPY: ALU::compare(Y, load(addressing), SR); return;
+        case Instruction::BIT: ALU::test_bits(A, load(addressing), SR); return;
+
+        case Instruction::LDA: update_flags(A = load(addressing)); return;
+        case Instruction::LDX: update_flags(X = load(addressing)); return;
+        case Instruction::LDY: update_flags(Y = load(addressing)); return;
+
+        case Instruction::STA: write(effective_address(addressing, true), A); return;
+        case Instruction::STX: write(effective_address(addressing, true), X); return;
+        case Instruction::STY: write(effective_address(addressing, true), Y); return;
+
+        case Instruction::ASL: modify(addressing, ALU::shift_left); return;
+        case Instruction::LSR: modify(addressing, ALU::shift_right); return;
+        case Instruction::ROL: modify(addressing, ALU::rotate_left); return;
+        case Instruction::ROR: modify(addressing, ALU::rotate_right); return;
+        case Instruction::INC: modify(addressing, ALU::increment); return;
+        case Instruction::DEC: modify(addressing, ALU::decrement); return;
+
+        case Instruction::BCC: branch(!SR.carry); return;
+        case Instruction::BCS: branch(SR.carry); return;
+        case Instruction::BNE: branch(!SR.zero); return;
+        case Instruction::BEQ: branch(SR.zero); return;
+        case Instruction::BPL: branch(!SR.negative); return;
+        case Instruction::BMI: branch(SR.negative); return;
+        case Instruction::BVC: branch(!SR.overflow); return;
+        case Instruction::BVS: branch(SR.overflow); return;
+
+        case Instruction::JMP: {
+            const auto low  = fetch();
+            const auto high = fetch();
+            PC              = make_word(high, low);
+            if (addressing == Addressing::Indirect) {
+                // The high byte of the pointer is not incremented, so the target never crosses a page
+                const auto target_low  = read(PC);
+                const auto target_high = read((PC & 0xFF00) | ((PC + 1) & 0x00FF));
+                PC                     = make_word(target_high, target_low);
+            }
+            return;
+        }
+        case Instruction::JSR: {
+            const auto low = fetch();
+            read(0x0100 | SP);
+            push(static_cast<uint8_t>(PC >> 8));
+            push(static_cast<uint8_t>(PC));
+            const auto high = fetch();
+            PC              = make_word(high, low);
+            return;
+        }
+        case Instruction::RTS: {
+            read(PC);
+            read(0x0100 | SP);
+            const auto low  = pull();
+            const auto high = pull();
+            PC              = make_word(high, low);
+            read(PC++);
+            return;
+        }
+        case Instruction::RTI: {
+            read(PC);
+            read(0x0100 | SP);
+            SR              = StatusRegister::from_byte(pull());
+            SR.break_       = false;
+            SR.expansion    = false;
+            const auto low  = pull();
+            const auto high = pull();
+            PC              = make_word(high, low);
+            return;
+        }
+        case Instruction::BRK:
+            fetch(); // the padding byte is skipped
+            interrupt(IRQ, true);
+            return;
+
+        case Instruction::PHA: read(PC); push(A); return;
+        case Instruction::PHP: read(PC); push(SR.to_byte() | 0x30); return;
+        case Instruction::PLA:
+            read(PC);
+            read(0x0100 | SP);
+            update_flags(A = pull());
+            return;
+        case Instruction::PLP:
+            read(PC);
+            read(0x0100 | SP);
+            SR           = StatusRegister::from_byte(pull());
+            SR.break_    = false;
+            SR.expansion = false;
+            return;
+
+        default: break;
+        }
+
+        // All the remaining instructions are implicit and take two cycles
+        read(PC);
+        switch (instruction) {
+        case Instruction::CLC: SR.carry = false; return;
+        case Instruction::CLD: SR.decimal = false; return;
+        case Instruction::CLI: SR.interrupt = false; return;
+        case Instruction::CLV: SR.overflow = false; return;
+        case Instruction::SEC: SR.carry = true; return;
+        case Instruction::SED: SR.decimal = true; return;
+        case Instruction::SEI: SR.interrupt = true; return;
+
+        case Instruction::TAX: update_flags(X = A); return;
+        case Instruction::TAY: update_flags(Y = A); return;
+        case Instruction::TSX: update_flags(X = SP); return;
+        case Instruction::TXA: update_flags(A = X); return;
+        case Instruction::TXS: SP = X; return; // the only transfer that does not affect the flags
+        case Instruction::TYA: update_flags(A = Y); return;
+
+        case Instruction::INX: X = ALU::increment(X, SR); return;
+        case Instruction::INY: Y = ALU::increment(Y, SR); return;
+        case Instruction::DEX: X = ALU::decrement(X, SR); return;
+        case Instruction::DEY: Y = ALU::decrement(Y, SR); return;
+
+        case Instruction::NOP: return;
+        default: std::unreachable();
+        }
+    }
+
+    /**
+     * @brief Program counter
+     *
+     * The program counter keeps track of the memory location holding the current instruction code.
+     * Its content is automatically stepped up as the program is executed and is modified by branch and jump operations.
+     * As it must be able to address the full 16-bit address range of 64K bytes, it's the only 16-bit register of the
+     * 6502.
+     */
+    uint16_t PC = 0;
+
+    /**
+     * @brief Stack pointer
+     *
+     * The stack pointer points to the current top of stack, or rather, to its bottom, as the stack grows top-down.
+     * The processor stack is located on memory page #1 ($0100–$01FF), 256 bytes Last-In-First-Out (LIFO) stack,
+     * which enables subroutines and also serves as a quick intermediate storage.
+     * As an 8-bit register, the stack pointer holds just the low-byte of this address (the offset from $0100.)
+     * Be aware that this just wraps around in case that the stack underflows.
+     */
+    uint8_t SP = 0;
+
+    /**
+     * @brief Accumulator
+     *
+     * Along with the arithmetic and logic unit, the accumulator is the main component of the processor.
+     * It is the implicit source and destination of all arithmetic and logical operations.
+     */
+    uint8_t A = 0;
+
+    /**
+     * @brief Index register X
+     *
+     * It is mostly used as an offset for indexed addressing and as a counter.
+     * It is also the only register that can be transferred to and from the stack pointer.
+     */
+    uint8_t X = 0;
+
+    /**
+     * @brief Index register Y
+     *
+     * It is mostly used as an offset for indexed addressing and as a counter.
+     */
+    uint8_t Y = 0;
+
+    /// @brief Processor status
+    StatusRegister SR;
+
+private:
+    [[nodiscard]] constexpr Bus &bus() noexcept { return static_cast<Bus &>(*this); }
+
+    /**
+     * @brief Compute the effective address of the operand, fetching the rest of the instruction
+     *
+     * @param addressing Any addressing mode that refers to a memory location
+     * @param write If @p true, the indexed modes always spend a cycle on fixing the high byte of the address,
+     *              as the hardware does for stores and read-modify-write instructions.
+     *              Otherwise, the cycle is only spent if a page boundary is crossed.
+     */
+    [[nodiscard]] constexpr uint16_t effective_address(const Addressing addressing, const bool write) noexcept {
+        switch (addressing) {
+        case Addressing::ZeroPage: return fetch();
+        case Addressing::ZeroPageX: {
+            const auto base = fetch();
+            read(base);
+            return static_cast<uint8_t>(base + X); // wraps around the zero page
+        }
+        case Addressing::ZeroPageY: {
+            const auto base = fetch();
+            read(base);
+            return static_cast<uint8_t>(base + Y); // wraps around the zero page
+        }
+        case Addressing::Absolute: {
+            const auto low  = fetch();
+            const auto high = fetch();
+            return make_word(high, low);
+        }
+        case Addressing::AbsoluteX: {
+            const auto low  = fetch();
+            const auto high = fetch();
+            return indexed(make_word(high, low), X, write);
+        }
+        case Addressing::AbsoluteY: {
+            const auto low  = fetch();
+            const auto high = fetch();
+            return indexed(make_word(high, low), Y, write);
+        }
+        case Addressing::IndexedIndirect: {
+            const auto base = fetch();
+            read(base);
+            const auto pointer = static_cast<uint8_t>(base + X);
+            const auto low     = read(pointer);
+            const auto high    = read(static_cast<uint8_t>(pointer + 1));
+            return make_word(high, low);
+        }
+        case Addressing::IndirectIndexed: {
+            const auto pointer = fetch();
+            const auto low     = read(pointer);
+            const auto high    = read(static_cast<uint8_t>(pointer + 1));
+            return indexed(make_word(high, low), Y, write);
+        }
+        default: std::unreachable();
+        }
+    }
+
+    /**
+     * @brief Add an index to a base address performing the dummy read of the partially computed address
+     *
+     * @copydetails effective_address
+     */
+    [[nodiscard]] constexpr uint16_t indexed(const uint16_t base, const uint8_t index, const bool write) noexcept {
+        const auto address = static_cast<uint16_t>(base + index);
+        // The low byte is added first, so an address within the base page is read before the high byte is fixed
+        if (write || (address & 0xFF00) != (base & 0xFF00)) read((base & 0xFF00) | (address & 0x00FF));
+        return address;
+    }
+
+    /**
+     * @brief Fetch the operand of a reading instruction
+     */
+    [[nodiscard]] constexpr uint8_t load(const Addressing addressing) noexcept {
+        if (addressing == Addressing::Immediate) return fetch();
+        return read(effective_address(addressing, false));
+    }
+
+    /**
+     * @brief Apply a read-modify-write operation to the accumulator or to the memory
+     */
+    constexpr void modify(const Addressing addressing,
+                          uint8_t (*const operation)(uint8_t, StatusRegister &) noexcept) noexcept {
+        if (addressing == Addressing::Accumulator) {
+            read(PC);
+            A = operation(A, SR);
+            return;
+        }
+
+        const auto address = effective_address(addressing, true);
+        const auto value   = read(address);
+        write(address, value); // the hardware writes the unmodified value back while computing the result
+        write(address, operation(value, SR));
+    }
+
+    /**
+     * @brief Branch to a relative address if the condition holds
+     */
+    constexpr void branch(const bool condition) noexcept {
+        const auto offset = static_cast<int8_t>(fetch());
+        if (!condition) return;
+
+        read(PC);
+        const auto target = static_cast<uint16_t>(PC + offset);
+        if ((target & 0xFF00) != (PC & 0xFF00)) read((PC & 0xFF00) | (target & 0x00FF));
+        PC = target;
+    }
+
+    /**
+     * @brief Set the negative and zero flags after a value was transferred to a register
+     */
+    constexpr void update_flags(const uint8_t value) noexcept {
+        SR.negative = value & 0x80;
+        SR.zero     = value == 0;
+    }
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_CORE_HPP
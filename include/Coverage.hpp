@@ -0,0 +1,121 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_COVERAGE_HPP
+#define EMULATOR_MOS_6502_COVERAGE_HPP
+#include "Memory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Bitmaps of the memory addresses accessed by the CPU, one bit per address and kind of access
+ *
+ * Each bitmap takes 8 KB, so all of them fit into the L1 cache together with the hot part of the memory.
+ * Marking an access is a branch-free bit set, and bitmaps of different runs are merged with a bitwise OR
+ * over machine words, which the compiler vectorizes.
+ */
+class Coverage {
+public:
+    /**
+     * @brief Mark an access to an address
+     */
+    void mark(const Access access, const uint16_t address) noexcept {
+        _bitmaps[static_cast<size_t>(access)][address >> 6] |= uint64_t{ 1 } << (address & 63);
+    }
+
+    /**
+     * @brief Check whether an address was accessed
+     */
+    [[nodiscard]] bool test(Access access, uint16_t address) const noexcept;
+
+    /**
+     * @brief The number of distinct addresses accessed
+     */
+    [[nodiscard]] size_t count(Access access) const noexcept;
+
+    /**
+     * @brief Forget all the accesses
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Merge the accesses of another run into this one
+     */
+    Coverage &operator|=(const Coverage &other) noexcept;
+
+    /**
+     * @brief Write the accessed addresses as JSON
+     *
+     * The addresses are grouped into inclusive ranges to keep the output small:
+     * @code{json}
+     * {"execute": [[512, 519]], "read": [[0, 1], [65532, 65533]], "write": []}
+     * @endcode
+     */
+    void write_json(std::ostream &stream) const;
+
+    /**
+     * @brief Write a 256x256 heatmap of the accesses as a binary PPM image
+     *
+     * Every pixel represents an address, every row a memory page.
+     * The red channel shows executions, the green one reads and the blue one writes.
+     */
+    void write_image(std::ostream &stream) const;
+
+private:
+    /// @brief Bitmap of the whole address space
+    using Bitmap = std::array<uint64_t, 0x10000 / 64>;
+
+    alignas(64) std::array<Bitmap, 3> _bitmaps{};
+};
+
+/**
+ * @brief Bitmap of the control flow edges taken by the CPU
+ *
+ * An edge leads from a branch, jump, subroutine call, return or interrupt to the address executed after it,
+ * so a conditional branch has different edges for its two outcomes.
+ * The edge from @p from to @p to sets the bit @p from / 2 XOR @p to, as in AFL:
+ * the halving keeps the edges between two addresses in opposite directions apart.
+ * Unrelated edges may share a bit, which only makes the coverage slightly coarser.
+ */
+class EdgeCoverage {
+public:
+    /// @brief Number of 64-bit words in the bitmap
+    static constexpr size_t words = 0x10000 / 64;
+
+    using Bitmap = std::array<uint64_t, words>;
+
+    /**
+     * @brief Mark the edge from the instruction at one address to the next executed one
+     */
+    void mark(const uint16_t from, const uint16_t to) noexcept {
+        const auto index = static_cast<uint16_t>(from >> 1 ^ to);
+        _bitmap[index >> 6] |= uint64_t{ 1 } << (index & 63);
+    }
+
+    /**
+     * @brief The number of distinct edges taken, up to the collisions
+     */
+    [[nodiscard]] size_t count() const noexcept;
+
+    /**
+     * @brief Forget all the edges
+     */
+    void clear() noexcept;
+
+    [[nodiscard]] const Bitmap &bitmap() const noexcept;
+
+    /**
+     * @brief Merge the edges of another run into this one
+     */
+    EdgeCoverage &operator|=(const EdgeCoverage &other) noexcept;
+
+private:
+    alignas(64) Bitmap _bitmap{};
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_COVERAGE_HPP
@@ -0,0 +1,142 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_FUZZER_HPP
+#define EMULATOR_MOS_6502_FUZZER_HPP
+#include "Coverage.hpp"
+#include "Sandbox.hpp"
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Coverage-guided fuzzer of a routine that processes an input buffer
+ *
+ * Every execution mutates an input of the corpus, places it into the memory with its length,
+ * and calls the routine in a @link Sandbox @endlink. The sandbox restores only the pages written by the previous
+ * execution, so an execution costs little more than the routine itself.
+ *
+ * The control flow edges of an execution are compared with a bitmap shared by all the workers.
+ * An input that takes a new edge joins the corpus of its worker, and the workers exchange their new inputs
+ * every given number of executions. An execution that does not return is a finding: a crash if it jammed,
+ * a hang if it spent the cycle budget. Findings are deduplicated by their kind and the address they stopped at.
+ */
+class Fuzzer {
+public:
+    struct Options {
+        uint16_t entry    = 0;   ///< Address of the routine
+        uint16_t buffer   = 0;   ///< Address the input is placed at
+        uint16_t length   = 0;   ///< Address of the input length, a 16-bit little-endian number
+        size_t max_length = 256; ///< Longest input the buffer holds
+        Sandbox::Limits limits{ .cycles = 100'000 };
+        unsigned threads = 0;     ///< Number of workers, zero means the number of hardware threads
+        size_t sync      = 1'024; ///< Number of executions of a worker between the exchanges of the corpus
+        uint64_t seed    = 0;     ///< Seed of the random mutations
+    };
+
+    /// @brief Input that made the routine fail
+    struct Finding {
+        Sandbox::Termination termination;
+        uint16_t address; ///< Program counter at the termination
+        std::vector<uint8_t> input;
+    };
+
+    struct Report {
+        size_t executions = 0;
+        size_t corpus     = 0; ///< Number of inputs in the corpus
+        size_t edges      = 0; ///< Number of distinct edges taken, up to the collisions
+        std::vector<Finding> findings;
+    };
+
+    /**
+     * @param image Memory with the routine, restored before every execution
+     */
+    Fuzzer(const Memory &image, Options options);
+
+    /**
+     * @brief Add an input to start from
+     *
+     * Without any seeds, the fuzzing starts from an empty input.
+     */
+    void add_seed(std::span<const uint8_t> input);
+
+    /**
+     * @brief Execute the routine a number of times, continuing the previous runs
+     *
+     * @throws std::bad_alloc If a worker runs out of memory, which stops all of them
+     */
+    Report run(size_t executions);
+
+    /**
+     * @brief Inputs that took new edges, starting with the seeds
+     */
+    [[nodiscard]] const std::vector<std::vector<uint8_t>> &corpus() const noexcept;
+
+private:
+    /// @brief State of a worker during a run
+    struct Worker {
+        Sandbox sandbox;
+        EdgeCoverage edges{};
+        std::mt19937_64 random;
+        std::vector<std::vector<uint8_t>> corpus{};
+        std::vector<std::vector<uint8_t>> discovered{}; ///< Inputs not shared with the others yet
+        size_t cursor = 0; ///< Number of inputs of the shared corpus already taken
+    };
+
+    /**
+     * @brief Mutate and execute inputs until the executions of the run are taken
+     *
+     * The first exception is kept for @link run @endlink to rethrow, and it stops all the workers.
+     */
+    void work(Worker &worker) noexcept;
+
+    /**
+     * @brief Apply a few random mutations to an input of the corpus
+     */
+    [[nodiscard]] std::vector<uint8_t> mutate(Worker &worker) const;
+
+    /**
+     * @brief Execute the routine with an input and merge its edges into the shared bitmap
+     *
+     * @retval true If the input took a new edge
+     */
+    bool execute(Worker &worker, const std::vector<uint8_t> &input);
+
+    /**
+     * @brief Give the discovered inputs to the others and take theirs
+     */
+    void synchronize(Worker &worker);
+
+    Memory _image;
+
+    Options _options;
+
+    std::vector<std::vector<uint8_t>> _corpus;
+
+    std::mutex _mutex; ///< Guards the corpus, the findings and the failure
+
+    std::vector<Finding> _findings;
+
+    /// @brief First exception thrown by a worker
+    std::exception_ptr _failure;
+
+    std::array<std::atomic<uint64_t>, EdgeCoverage::words> _edges{};
+
+    /// @brief Number of executions left in the current run
+    std::atomic<size_t> _remaining = 0;
+
+    size_t _executions = 0;
+
+    size_t _runs = 0;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_FUZZER_HPP
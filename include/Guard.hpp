@@ -0,0 +1,105 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_GUARD_HPP
+#define EMULATOR_MOS_6502_GUARD_HPP
+#include "Memory.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Access permissions of memory regions and a budget of writes
+ *
+ * Unlike the ROM masks of @link Memory @endlink, which silently ignore the writes, the guard denies an access
+ * and stops the CPU. Every page has its own permissions for each kind of access, and every bus access is checked,
+ * including the dummy reads and the stack operations of the hardware.
+ *
+ * The first violation is sticky: all the following accesses are denied as well,
+ * so the rest of the instruction has no effect on the memory.
+ */
+class Guard {
+public:
+    /// @brief Write budget of a guard that does not limit the writes
+    static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    /// @brief The denied access
+    struct Violation {
+        /// @brief Reason of the denial
+        enum class Kind : uint8_t {
+            Permission,  ///< The page does not permit the access
+            WriteBudget, ///< All the permitted writes were performed
+        };
+
+        Kind kind;
+        Access access;
+        uint16_t address;
+    };
+
+    /**
+     * @brief Create a guard permitting everything
+     */
+    Guard() noexcept;
+
+    /**
+     * @brief Set the permissions of a range of pages, replacing the previous ones
+     *
+     * @param accesses Kinds of the permitted accesses, the other ones are denied
+     */
+    void permit(uint8_t first_page, uint8_t last_page, std::initializer_list<Access> accesses) noexcept;
+
+    /**
+     * @brief Limit the number of writes, counting from the current one
+     */
+    void set_write_budget(size_t writes) noexcept;
+
+    /**
+     * @brief Forget the violation and the performed writes
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Check an access and count it if it is a permitted write
+     *
+     * @retval false If the access is denied, it must not be performed then
+     */
+    [[nodiscard]] bool permits(const Access access, const uint16_t address) noexcept {
+        const bool permitted = !_violation && (_pages[address >> 8] >> static_cast<unsigned>(access) & 1) != 0;
+        if (permitted && access != Access::Write) [[likely]]
+            return true;
+        return count(access, address, permitted);
+    }
+
+    /**
+     * @brief The first denied access
+     */
+    [[nodiscard]] const std::optional<Violation> &violation() const noexcept;
+
+    /**
+     * @brief Number of permitted writes
+     */
+    [[nodiscard]] size_t writes() const noexcept;
+
+private:
+    /**
+     * @brief Handle the writes and the denied accesses out of the fast path
+     */
+    [[nodiscard]] bool count(Access access, uint16_t address, bool permitted) noexcept;
+
+    /// @brief Permitted kinds of access of every page, one bit per @link Access @endlink
+    std::array<uint8_t, 256> _pages{};
+
+    size_t _writes = 0;
+
+    size_t _write_budget = unlimited;
+
+    std::optional<Violation> _violation;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_GUARD_HPP
@@ -0,0 +1,41 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_HOST_CALL_HPP
+#define EMULATOR_MOS_6502_HOST_CALL_HPP
+#include "Core.hpp"
+#include "Memory.hpp"
+#include <cstddef>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Native routine that the guest invokes by executing a trap opcode, e.g. a multiplication or a block copy
+ *
+ * The trap opcode is one of the illegal ones, on which the CPU would jam otherwise, see @link CPU::set_host_call
+ * @endlink. A hot routine of the guest is then accelerated by replacing its first instruction with the trap
+ * followed by an @p RTS, without rewriting the rest of the program.
+ */
+class HostCall {
+public:
+    virtual ~HostCall() = default;
+
+    /**
+     * @brief Perform the routine on behalf of the guest
+     *
+     * The memory is accessed directly, bypassing the devices, the guard and the observers of the CPU.
+     * The writes still go through @link Memory::write @endlink, so the ROM is kept intact.
+     * Since the observers, the guard and the devices would miss them, the CPU does not take the trap while any of
+     * those is attached, see @link CPU::set_host_call @endlink.
+     *
+     * @param[in, out] registers PC points past the trap opcode. Any register may be changed,
+     *                           e.g. to return a result or to continue elsewhere.
+     * @param[in, out] memory Memory of the CPU
+     *
+     * @return Number of cycles the routine costs, charged in addition to the fetch of the trap opcode
+     */
+    [[nodiscard]] virtual size_t call(Registers &registers, Memory &memory) noexcept = 0;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_HOST_CALL_HPP
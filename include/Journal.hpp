@@ -0,0 +1,244 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_JOURNAL_HPP
+#define EMULATOR_MOS_6502_JOURNAL_HPP
+#include "CPU.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Record of everything a run receives from outside the CPU, so that the run can be replayed exactly
+ *
+ * Three kinds of events are recorded with the cycle they happen at:
+ * - the values read from the devices of @link Scheduler @endlink,
+ * - the interrupts taken by the CPU, which are the only effect of the interrupt lines on the execution,
+ * - the input of the host, i.e. the bytes it puts into the memory between the instructions.
+ *
+ * Every event is encoded into a byte stream as its kind, the difference of its cycle from the previous event in
+ * LEB128 and its payload, so an event usually takes two to five bytes.
+ *
+ * In the replay, the devices are not read and the interrupt lines are ignored: the recorded values and interrupts
+ * are fed to the CPU at the same cycles instead. The writes to the devices still reach them.
+ *
+ * Snapshots of the CPU are taken every given number of cycles, both while recording and while replaying,
+ * so that @link seek @endlink restores the closest one and only executes the rest of the way.
+ *
+ * The hooks of the CPU never throw. If the stream cannot grow, the recording stops before the event
+ * and @link overflowed @endlink is set, so the stream stays valid up to that point.
+ * A snapshot that cannot be allocated is skipped, which only makes seeking execute a longer way.
+ */
+class Journal {
+public:
+    /// @brief What the journal does with the events
+    enum class Mode : uint8_t {
+        Idle,   ///< Neither recording nor replaying
+        Record, ///< Events are appended to the stream
+        Replay, ///< Events are taken from the stream
+    };
+
+    /// @brief Event received from outside the CPU
+    struct Event {
+        enum class Kind : uint8_t {
+            DeviceRead, ///< A device was read, @link value @endlink holds the result
+            Interrupt,  ///< The maskable interrupt was taken
+            NonMaskable, ///< The non-maskable interrupt was taken
+            Input,      ///< The host wrote @link value @endlink into the memory
+        };
+
+        Kind kind;
+        size_t cycle     = 0;
+        uint16_t address = 0;
+        uint8_t value    = 0;
+
+        bool operator==(const Event &) const noexcept = default;
+    };
+
+    /**
+     * @param snapshot_interval Number of cycles between the snapshots, zero disables them
+     */
+    explicit Journal(size_t snapshot_interval = 0) noexcept;
+
+    /**
+     * @brief Start recording from the current state of a CPU, discarding the previous events and snapshots
+     *
+     * @param cpu Must have the journal attached
+     */
+    void record(const CPU &cpu);
+
+    /**
+     * @brief Start replaying from the state the recording started at
+     *
+     * A loaded journal has no snapshots, so the current state of the CPU is taken as the initial one.
+     */
+    void replay(CPU &cpu);
+
+    /**
+     * @brief Replay up to the first instruction boundary at or after a cycle
+     *
+     * The closest snapshot before the cycle is restored and the rest of the way is executed.
+     * A replaying CPU that is already past that snapshot and before the cycle just continues.
+     *
+     * @retval false If the CPU stopped before reaching the cycle
+     */
+    bool seek(CPU &cpu, size_t cycle);
+
+    /**
+     * @brief Continue recording where the replay ran out of events, appending to the same stream
+     *
+     * @retval false If the journal is not replaying or the replay has not consumed the whole stream
+     */
+    bool resume() noexcept;
+
+    /**
+     * @brief Cycle of the last snapshot at or before a cycle, or of the first snapshot if there is none
+     */
+    [[nodiscard]] size_t closest(size_t cycle) const noexcept;
+
+    /**
+     * @brief Put host input into the memory of a CPU between its instructions
+     *
+     * It is recorded while recording, and ignored while replaying, since the recorded input is used instead.
+     */
+    void input(CPU &cpu, uint16_t address, uint8_t value);
+
+    /**
+     * @brief Stop recording or replaying
+     */
+    void stop() noexcept;
+
+    [[nodiscard]] Mode mode() const noexcept { return _mode; }
+
+    /**
+     * @brief Whether the replay requested an event that is not in the stream
+     *
+     * It only happens if the replayed CPU was not in the same state, e.g. executed a different program.
+     */
+    [[nodiscard]] bool diverged() const noexcept;
+
+    /**
+     * @brief Whether the recording stopped because the stream could not grow
+     */
+    [[nodiscard]] bool overflowed() const noexcept;
+
+    /**
+     * @brief Decode all the recorded events
+     */
+    [[nodiscard]] std::vector<Event> events() const;
+
+    /**
+     * @brief The encoded stream
+     */
+    [[nodiscard]] const std::vector<uint8_t> &stream() const noexcept;
+
+    /**
+     * @brief Number of snapshots available for seeking
+     */
+    [[nodiscard]] size_t snapshots() const noexcept;
+
+    /**
+     * @brief Write the stream
+     */
+    void save(std::ostream &output) const;
+
+    /**
+     * @brief Replace the stream and drop the snapshots
+     *
+     * @retval false If the stream cannot be read
+     */
+    bool load(std::istream &input);
+
+    /// @name Hooks of the CPU
+    /// @{
+
+    /**
+     * @brief Take a due snapshot or apply the due input at an instruction boundary
+     */
+    void boundary(CPU &cpu) noexcept;
+
+    /**
+     * @brief Record a value read from a device
+     */
+    void record_read(size_t cycle, uint16_t address, uint8_t value) noexcept;
+
+    /**
+     * @brief Take the recorded value of a device read
+     */
+    [[nodiscard]] uint8_t replay_read(size_t cycle, uint16_t address) noexcept;
+
+    /**
+     * @brief Record an interrupt taken by the CPU
+     */
+    void record_interrupt(size_t cycle, uint16_t vector) noexcept;
+
+    /**
+     * @brief Take the vector of the interrupt recorded at a cycle, if any
+     */
+    [[nodiscard]] std::optional<uint16_t> replay_interrupt(size_t cycle) noexcept;
+    /// @}
+
+private:
+    /// @brief Snapshot with the position of the stream at its cycle
+    struct Checkpoint {
+        CPU::Snapshot snapshot;
+        size_t position; ///< Offset of the first event after the snapshot
+        size_t previous; ///< Cycle of the last event before the snapshot, the base of the next difference
+    };
+
+    /**
+     * @brief Append an event to the stream, or stop recording if it cannot grow
+     */
+    void append(const Event &event) noexcept;
+
+    /**
+     * @brief Decode the event at the replay position, if any
+     */
+    [[nodiscard]] std::optional<Event> decode(size_t &position, size_t &previous) const noexcept;
+
+    /**
+     * @brief The next event of the replay without consuming it
+     */
+    [[nodiscard]] const std::optional<Event> &peek() noexcept;
+
+    /**
+     * @brief Consume the event returned by @link peek @endlink
+     */
+    void consume() noexcept;
+
+    /**
+     * @brief Take a snapshot if the CPU is past the next scheduled one
+     */
+    void checkpoint(const CPU &cpu) noexcept;
+
+    std::vector<uint8_t> _stream;
+
+    std::vector<Checkpoint> _checkpoints;
+
+    size_t _interval;
+
+    Mode _mode = Mode::Idle;
+
+    /// @brief Offset of the next event to replay
+    size_t _position = 0;
+
+    /// @brief Cycle of the last recorded or replayed event
+    size_t _previous = 0;
+
+    /// @brief Decoded event at @link _position @endlink
+    std::optional<Event> _next;
+
+    bool _decoded = false;
+
+    bool _diverged = false;
+
+    bool _overflowed = false;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_JOURNAL_HPP
@@ -0,0 +1,189 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_LOCKSTEP_HPP
+#define EMULATOR_MOS_6502_LOCKSTEP_HPP
+#include "CPU.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Lockstep execution of up to 32 instances of the same program with different memories
+ *
+ * The registers of all the instances, called lanes, are kept in a structure of arrays.
+ * Every step dispatches a single opcode for the group of lanes that are about to execute it at the same address.
+ * The operands are gathered from the memories of the lanes one by one, but the arithmetic, logic and flag updates
+ * are applied to all the lanes at once by branch-free loops over the arrays, which the compiler turns into vector
+ * instructions (AVX2 covers all the 32 byte-sized lanes in a single register).
+ * Only the decimal mode falls back to @link ALU @endlink lane by lane.
+ *
+ * Once the lanes diverge, e.g. on a branch, the group with the lowest program counter runs first.
+ * Loops jump backwards, so the lanes that left a loop wait for those still iterating, and the groups reconverge.
+ *
+ * Every lane behaves exactly as a @link CPU @endlink with the same memory, including the cycle counts,
+ * but without interrupt lines, devices or observers.
+ */
+class Lockstep {
+public:
+    /// @brief Maximal number of lanes
+    static constexpr size_t max_lanes = 32;
+
+    /**
+     * @brief Create the lanes and reset them
+     *
+     * @param memories Memory of every lane, at most @link max_lanes @endlink of them
+     */
+    explicit Lockstep(std::vector<Memory> memories) noexcept;
+
+    /**
+     * @brief Execute a single instruction in the next group of lanes
+     *
+     * @retval false If no lane can execute anything: all of them either jammed or spent their budget.
+     */
+    bool step() noexcept;
+
+    /**
+     * @brief Execute every lane until it spends a cycle budget or jams
+     *
+     * @see CPU::run
+     */
+    void run(size_t cycles) noexcept;
+
+    /**
+     * @brief Number of lanes
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    [[nodiscard]] CPU::Registers registers(size_t lane) const noexcept;
+
+    void set_registers(size_t lane, const CPU::Registers &registers) noexcept;
+
+    /**
+     * @brief The number of clock cycles elapsed in a lane
+     */
+    [[nodiscard]] size_t cycle(size_t lane) const noexcept;
+
+    /**
+     * @brief Whether a lane stopped at an illegal opcode
+     */
+    [[nodiscard]] bool jammed(size_t lane) const noexcept;
+
+    [[nodiscard]] const Memory &memory(size_t lane) const noexcept;
+
+    /**
+     * @brief Number of dispatched opcodes, each of which was executed by a group of lanes
+     */
+    [[nodiscard]] size_t dispatches() const noexcept;
+
+    /**
+     * @brief Number of instructions executed by all the lanes together
+     */
+    [[nodiscard]] size_t instructions() const noexcept;
+
+private:
+    /// @brief Set of lanes, one bit per lane
+    using Mask = uint32_t;
+
+    template <typename T>
+    using Lanes = std::array<T, max_lanes>;
+
+    /// @brief Select the lanes of a group for the vectorized operations
+    void select(Mask group) noexcept;
+
+    /**
+     * @brief Execute an instruction whose opcode has already been fetched by a group of lanes
+     */
+    void execute(Mask group, Instruction instruction, Addressing addressing) noexcept;
+
+    /// @name Lane-by-lane bus accesses, see the counterparts in @link CPU @endlink
+    /// @{
+    uint8_t read(size_t lane, uint16_t address) noexcept;
+
+    uint8_t fetch(size_t lane) noexcept;
+
+    void write(size_t lane, uint16_t address, uint8_t value) noexcept;
+
+    void push(size_t lane, uint8_t value) noexcept;
+
+    uint8_t pull(size_t lane) noexcept;
+
+    [[nodiscard]] uint16_t effective_address(size_t lane, Addressing addressing, bool write) noexcept;
+
+    [[nodiscard]] uint16_t indexed(size_t lane, uint16_t base, uint8_t index, bool write) noexcept;
+    /// @}
+
+    /**
+     * @brief Fetch the operands of a reading instruction of a group into @link _operand @endlink
+     */
+    void gather(Mask group, Addressing addressing) noexcept;
+
+    /**
+     * @brief Apply an element-wise operation to a register and the status of the selected lanes
+     *
+     * @param operation Takes the register and the status, returns the new values of both
+     */
+    template <typename Operation>
+    void apply(Lanes<uint8_t> &target, Operation operation) noexcept;
+
+    /**
+     * @brief Perform ADC or SBC on the selected lanes, falling back to @link ALU @endlink in the decimal mode
+     */
+    void arithmetic(Mask group, bool subtract) noexcept;
+
+    /**
+     * @brief Apply a read-modify-write operation to the accumulator or to the memory
+     *
+     * @copydetails apply
+     */
+    template <typename Operation>
+    void modify(Mask group, Addressing addressing, Operation operation) noexcept;
+
+    /**
+     * @brief Branch to a relative address in the lanes whose status satisfies a condition
+     */
+    void branch(Mask group, uint8_t flag, bool set) noexcept;
+
+    /**
+     * @brief Push the state and jump to the interrupt handler, as BRK does
+     */
+    void interrupt(size_t lane) noexcept;
+
+    alignas(32) Lanes<uint16_t> _pc{};
+    alignas(32) Lanes<uint8_t> _sp{};
+    alignas(32) Lanes<uint8_t> _a{};
+    alignas(32) Lanes<uint8_t> _x{};
+    alignas(32) Lanes<uint8_t> _y{};
+
+    /// @brief Status registers in the layout of @link StatusRegister::to_byte @endlink
+    alignas(32) Lanes<uint8_t> _p{};
+
+    /// @brief Operands gathered for the current instruction
+    alignas(32) Lanes<uint8_t> _operand{};
+
+    /// @brief 0xFF in the lanes of the current group and zero in the others, used to blend the results
+    alignas(32) Lanes<uint8_t> _selected{};
+
+    /// @brief Effective addresses of the read-modify-write instructions
+    Lanes<uint16_t> _address{};
+
+    Lanes<size_t> _cycle{};
+
+    /// @brief Cycle at which the budget of a lane is spent
+    Lanes<size_t> _end{};
+
+    std::vector<Memory> _memories;
+
+    Mask _jammed = 0;
+
+    size_t _dispatches = 0;
+
+    size_t _instructions = 0;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_LOCKSTEP_HPP
@@ -0,0 +1,58 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_MAPPED_FILE_HPP
+#define EMULATOR_MOS_6502_MAPPED_FILE_HPP
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief A read-only file mapped into the address space of the process
+ *
+ * The pages are only loaded by the kernel when they are touched, so the file is processed at disk speed
+ * without copying it through user-space buffers.
+ * The mapping is advised to be read sequentially, so that the kernel reads ahead aggressively.
+ */
+class MappedFile {
+public:
+    /**
+     * @brief Map a whole file
+     *
+     * @retval std::nullopt If the file cannot be opened or mapped
+     */
+    [[nodiscard]] static std::optional<MappedFile> open(const std::filesystem::path &path) noexcept;
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile(MappedFile &&other) noexcept;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    MappedFile &operator=(MappedFile &&other) noexcept;
+
+    ~MappedFile() noexcept;
+
+    /**
+     * @brief Contents of the file as raw bytes
+     */
+    [[nodiscard]] std::span<const std::byte> bytes() const noexcept;
+
+    /**
+     * @brief Contents of the file as text
+     */
+    [[nodiscard]] std::string_view text() const noexcept;
+
+private:
+    MappedFile(const std::byte *data, size_t size) noexcept;
+
+    const std::byte *_data = nullptr; ///< Start of the mapping, or null for an empty file
+    size_t _size           = 0;       ///< Size of the file in bytes
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_MAPPED_FILE_HPP
@@ -7,11 +7,21 @@
 #include <array>
 #include <cstdint>
 #include <limits>
+#include <memory>
 #include <unordered_set>
 
 // TODO: Implement Atari 2600 for a 6507 CPU with 8 KB of memory
 
 namespace emulator::mos_6502 {
+/**
+ * @brief Kind of memory access performed by the CPU
+ */
+enum class Access : uint8_t {
+    Execute, ///< The byte is a part of an executed instruction
+    Read,    ///< The byte is read as data, including the dummy reads of the hardware
+    Write,   ///< The byte is written, even if it belongs to the ROM
+};
+
 /**
  * @brief A device used as a memory for MOS 6502 CPU.
  *
@@ -28,6 +38,15 @@ namespace emulator::mos_6502 {
  * - 0xFFFA to 0xFFFB - Address of non-maskable interrupt handler
  * - 0xFFFC to 0xFFFD - Initial value of the program counter
  * - 0xFFFE to 0xFFFF - Address of maskable interrupt handler
+ *
+ * Every page keeps a running hash of its contents, updated by each write in constant time,
+ * and the hashes of all pages are combined into a digest of the whole memory.
+ * The hash of a page is the sum of a mixing function of every address and the byte stored there,
+ * so a write only replaces the term of its address. Two memories with equal digests hold the same contents
+ * up to a collision of 64-bit hashes, which makes comparing states as cheap as comparing two integers.
+ *
+ * The data is kept in a block of @link MemoryPool @endlink, so creating or copying a memory throws
+ * @p std::bad_alloc if the pool cannot map a new arena.
  */
 class Memory {
 public:
@@ -36,12 +55,19 @@ public:
      */
     using Data = std::array<uint8_t, static_cast<size_t>(std::numeric_limits<uint16_t>::max()) + 1>;
 
+    /**
+     * @brief Initialize with zeros and minimal partitioning
+     *
+     * Only the system vectors belong to the ROM, all other memory is read-write.
+     */
+    Memory();
+
     /**
      * @brief Initialize from existing data with minimal partitioning
      *
      * Only the system vectors belong to the ROM, all other memory is read-write.
      */
-    explicit Memory(const Data &data) noexcept;
+    explicit Memory(const Data &data);
 
     /**
      * @brief Initialize from existing data with a custom partition.
@@ -58,7 +84,29 @@ public:
      * The second mask is even simpler.
      * In binary, it is 0b1111111111111100, so any smaller address does not have enough initial ones.
      */
-    Memory(const Data &data, std::unordered_set<uint16_t> rom_masks) noexcept;
+    Memory(const Data &data, std::unordered_set<uint16_t> rom_masks);
+
+    /// @brief Copy the data into a new block of @link MemoryPool @endlink
+    Memory(const Memory &other);
+
+    /**
+     * @brief Take over the block of the other memory
+     *
+     * The other memory is left without a block, so it may only be destroyed or assigned to afterward.
+     */
+    Memory(Memory &&other) noexcept = default;
+
+    /**
+     * @brief Copy the contents, taking a new block if this memory was moved from
+     *
+     * The pages whose contents change are added to the modified ones, see @link take_modified @endlink.
+     */
+    Memory &operator=(const Memory &other);
+
+    /// @copydoc Memory(Memory &&)
+    Memory &operator=(Memory &&other) noexcept = default;
+
+    ~Memory() noexcept = default;
 
     /**
      * @brief Partitioning preset for Commodore64 machines.
@@ -78,7 +126,7 @@ public:
      *   - 0xE000 to 0xFFFF - The kernel ROM contained essential routines for low-level operations like I/O handling,
      *     screen display, and interrupt management.
      */
-    [[nodiscard]] static Memory Commodore64(const Data &data) noexcept;
+    [[nodiscard]] static Memory Commodore64(const Data &data);
 
     /**
      * @brief Partitioning preset for Apple II machines.
@@ -100,7 +148,7 @@ public:
      *   - 0xD000 to 0xFFFF - Contains the system firmware, including Integer BASIC, the monitor program,
      *     and other essential routines.
      */
-    [[nodiscard]] static Memory AppleII(const Data &data) noexcept;
+    [[nodiscard]] static Memory AppleII(const Data &data);
 
     /**
      * @brief Read a value at a given address
@@ -117,12 +165,56 @@ public:
      */
     bool write(uint16_t address, uint8_t value) noexcept;
 
+    /**
+     * @brief Bring the memory back to the contents of an image
+     *
+     * Only the pages written since the construction or the previous restoration are copied,
+     * so that a memory can be reused for the next run of a program within microseconds.
+     * The copied pages are added to the modified ones, see @link take_modified @endlink.
+     *
+     * @param image Memory this one was created from, with the same partition
+     */
+    void restore(const Memory &image) noexcept;
+
+    /**
+     * @brief Take the set of pages written since the previous call, one bit per page
+     *
+     * It is tracked apart from the pages used by @link restore @endlink, so that both can be used at once.
+     */
+    [[nodiscard]] std::array<uint64_t, 4> take_modified() noexcept;
+
+    /**
+     * @brief Hash of the whole contents
+     */
+    [[nodiscard]] uint64_t digest() const noexcept;
+
+    /**
+     * @brief Hash of the contents of a page, e.g. to find the pages where two memories differ
+     */
+    [[nodiscard]] uint64_t page_digest(uint8_t page) const noexcept;
+
 private:
     [[nodiscard]] bool within_rom(uint16_t address) const noexcept;
 
-    Data _data; ///< Encapsulated data
+    /// @brief Compute the hashes of all the pages from scratch
+    void rehash() noexcept;
+
+    /// @brief Gives the block back to @link MemoryPool @endlink
+    struct Recycle {
+        void operator()(Data *block) const noexcept;
+    };
+
+    std::unique_ptr<Data, Recycle> _data; ///< Encapsulated data, allocated from @link MemoryPool @endlink
 
     std::unordered_set<uint16_t> _rom_masks = { 0xFFFA, 0xFFFC }; ///< Masks defining read-only addresses
+
+    std::array<uint64_t, 4> _dirty{}; ///< Pages written since the last restoration, one bit per page
+
+    std::array<uint64_t, 4> _modified{}; ///< Pages written since the last call to @link take_modified @endlink
+
+    std::array<uint64_t, 256> _hashes{}; ///< Running hash of every page
+
+    uint64_t _digest = 0; ///< Sum of the hashes of all the pages
 };
 
 } // namespace emulator::mos_6502
@@ -0,0 +1,99 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_MEMORY_POOL_HPP
+#define EMULATOR_MOS_6502_MEMORY_POOL_HPP
+#include "Memory.hpp"
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Process-wide pool of the 64K blocks backing every @link Memory @endlink
+ *
+ * The blocks are carved out of 2 MB arenas, 32 blocks each, which are mapped as explicit huge pages when the system
+ * has them reserved, and advised to become transparent huge pages otherwise.
+ * So tens of thousands of memories take a few TLB entries instead of 16 entries each,
+ * and creating or destroying a memory never goes through malloc.
+ *
+ * Released blocks are recycled, the most recently released first, while it is still in the cache.
+ * The arenas are never returned to the system before the pool is destroyed.
+ */
+class MemoryPool {
+public:
+    /// @brief Size of an arena, equal to the size of a huge page
+    static constexpr size_t arena_size = size_t{ 2 } << 20;
+
+    static constexpr size_t blocks_per_arena = arena_size / sizeof(Memory::Data);
+
+    /**
+     * @brief The pool shared by all the memories
+     */
+    [[nodiscard]] static MemoryPool &instance() noexcept;
+
+    MemoryPool(const MemoryPool &) = delete;
+
+    MemoryPool &operator=(const MemoryPool &) = delete;
+
+    ~MemoryPool() noexcept;
+
+    /**
+     * @brief Take a block, mapping a new arena if none is free
+     *
+     * It is safe to call from any thread.
+     *
+     * @param zeroed If @p true, the block is filled with zeros, otherwise its contents are unspecified
+     *
+     * @throw std::bad_alloc If a new arena cannot be mapped
+     */
+    [[nodiscard]] Memory::Data *acquire(bool zeroed);
+
+    /**
+     * @brief Give a block back for recycling
+     *
+     * It is safe to call from any thread.
+     */
+    void release(Memory::Data *block) noexcept;
+
+    /**
+     * @brief Number of mapped arenas
+     */
+    [[nodiscard]] size_t arenas() const noexcept;
+
+    /**
+     * @brief Number of blocks waiting for recycling
+     */
+    [[nodiscard]] size_t available() const noexcept;
+
+    /**
+     * @brief Number of arenas mapped as explicit huge pages, the others rely on transparent huge pages
+     */
+    [[nodiscard]] size_t huge_arenas() const noexcept;
+
+private:
+    MemoryPool() noexcept = default;
+
+    /**
+     * @brief Map a new arena and make its blocks available
+     *
+     * @pre The mutex is locked.
+     */
+    void grow();
+
+    mutable std::mutex _mutex;
+
+    std::vector<std::byte *> _arenas;
+
+    /// @brief Blocks available for recycling, the last one is taken first
+    std::vector<Memory::Data *> _free;
+
+    /// @brief Blocks of fresh arenas, which are known to be zero
+    std::vector<Memory::Data *> _fresh;
+
+    size_t _huge_arenas = 0;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_MEMORY_POOL_HPP
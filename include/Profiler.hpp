@@ -0,0 +1,155 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_PROFILER_HPP
+#define EMULATOR_MOS_6502_PROFILER_HPP
+#include "Opcode.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Exact, sampling-free profiler of the emulated program
+ *
+ * Every executed instruction is accounted for in three ways:
+ * - hit and cycle counters indexed by the address of the instruction,
+ * - hit and cycle counters indexed by the opcode, aggregated by the instruction on demand,
+ * - cycles spent in the current call path.
+ *
+ * Call paths form a calling-context tree that only changes on JSR, RTS, BRK, RTI and hardware interrupts,
+ * so ordinary instructions only pay for a few counter increments.
+ * Routines are identified by their entry address.
+ *
+ * The program is free to manipulate the stack, so the call stack is synchronized with the stack pointer
+ * rather than with the calls and returns alone: a frame is dropped as soon as the stack pointer rises
+ * to the value it had before the call.
+ *
+ * Recording never throws. If the memory runs out, the calling-context tree stops growing,
+ * and the routines without a node are charged to their callers, see @link overflowed @endlink.
+ */
+class Profiler {
+public:
+    /// @brief Accumulated statistics of a code location or an instruction
+    struct Counter {
+        uint64_t hits   = 0; ///< Number of executions
+        uint64_t cycles = 0; ///< Number of cycles spent in the executions
+    };
+
+    /// @brief Number of distinct instructions
+    static constexpr size_t instruction_count = static_cast<size_t>(Instruction::TYA) + 1;
+
+    /**
+     * @throws std::bad_alloc If the counters cannot be allocated
+     */
+    Profiler();
+
+    /**
+     * @brief Account for an executed instruction
+     *
+     * @param pc Address of the instruction
+     * @param opcode Opcode of the instruction
+     * @param sp Stack pointer before the instruction
+     * @param cycles Number of cycles the instruction took
+     * @param target Program counter after the instruction
+     * @param next_sp Stack pointer after the instruction
+     */
+    void record(uint16_t pc, uint8_t opcode, uint8_t sp, size_t cycles, uint16_t target, uint8_t next_sp) noexcept;
+
+    /**
+     * @brief Account for a hardware interrupt sequence, which enters the handler like a call
+     *
+     * @param sp Stack pointer before the interrupt
+     * @param cycles Number of cycles the interrupt sequence took
+     * @param handler Address of the interrupt handler
+     */
+    void record_interrupt(uint8_t sp, size_t cycles, uint16_t handler) noexcept;
+
+    /**
+     * @brief Statistics of the instruction at a given address
+     */
+    [[nodiscard]] Counter at(uint16_t pc) const noexcept;
+
+    /**
+     * @brief Statistics of every instruction, indexed by @link Instruction @endlink
+     */
+    [[nodiscard]] std::array<Counter, instruction_count> instructions() const noexcept;
+
+    /**
+     * @brief Check whether the calling-context tree stopped growing since the last @link clear @endlink
+     */
+    [[nodiscard]] bool overflowed() const noexcept;
+
+    /**
+     * @brief Forget all the collected statistics
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Write the cycles spent in every call path in the collapsed-stack format
+     *
+     * Every line consists of semicolon-separated routine names from the outermost to the innermost one,
+     * followed by a space and the number of cycles spent in the innermost routine itself.
+     * Routines are named by their hexadecimal entry addresses, the outermost code is named "root".
+     * This is the input format of flamegraph.pl and of most other flame graph tools.
+     */
+    void write_collapsed_stacks(std::ostream &stream) const;
+
+    /**
+     * @brief Write the hits and cycles of every executed instruction, one mnemonic per line
+     */
+    void write_instruction_histogram(std::ostream &stream) const;
+
+private:
+    /// @brief Node of the calling-context tree
+    struct Node {
+        uint32_t parent  = 0; ///< Index of the calling path, the root is its own parent
+        uint16_t routine = 0; ///< Entry address of the innermost routine
+        uint64_t cycles  = 0; ///< Cycles spent in the innermost routine itself
+    };
+
+    /// @brief Active call
+    struct Frame {
+        uint32_t node = 0; ///< Path of the call
+        uint8_t sp    = 0; ///< Stack pointer before the call
+    };
+
+    /**
+     * @brief Enter a routine from the current path
+     */
+    void call(uint16_t routine, uint8_t sp) noexcept;
+
+    /**
+     * @brief Leave all the routines whose frames are no longer on the stack
+     */
+    void unwind(uint8_t sp) noexcept;
+
+    /// @brief Counters indexed by the address of the instruction
+    std::unique_ptr<std::array<Counter, 0x10000>> _addresses;
+
+    /// @brief Counters indexed by the opcode
+    std::array<Counter, 0x100> _opcodes{};
+
+    /// @brief Calling-context tree, the first node is the root
+    std::vector<Node> _nodes;
+
+    /// @brief Children of the tree nodes keyed by the parent index in the high bits and the routine in the low ones
+    std::unordered_map<uint64_t, uint32_t> _children;
+
+    /// @brief Active calls from the outermost to the innermost, with the capacity for a frame per stack pointer
+    std::vector<Frame> _stack;
+
+    /// @brief Index of the current path
+    uint32_t _current = 0;
+
+    /// @brief Whether a node could not be added to the calling-context tree
+    bool _overflowed = false;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_PROFILER_HPP
@@ -0,0 +1,113 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_REWIND_HPP
+#define EMULATOR_MOS_6502_REWIND_HPP
+#include "CPU.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Bounded history of the states of a CPU, captured periodically to step back in time
+ *
+ * Only the latest state is kept in full. Every older state holds its registers and the difference of its memory
+ * from the next state: the pages written in between, XOR-ed with their next contents and compressed.
+ * The differences are mostly zeros, so the codec only separates the runs of zeros from the literal bytes,
+ * which takes a single pass in both directions.
+ *
+ * Rewinding applies the differences from the newest one backwards, so it touches only the pages that changed
+ * and takes microseconds. The history is a ring: once the differences exceed the capacity, the oldest ones are
+ * dropped.
+ */
+class Rewind {
+public:
+    /**
+     * @param interval Number of cycles between the captured states
+     * @param capacity Number of bytes the differences may take, not counting the latest state
+     */
+    Rewind(size_t interval, size_t capacity) noexcept;
+
+    /**
+     * @brief Execute a CPU for a number of cycles, capturing its state every interval
+     *
+     * @retval false If the CPU stopped before spending the cycles
+     */
+    bool run(CPU &cpu, size_t cycles);
+
+    /**
+     * @brief Capture the current state of a CPU as the latest one
+     *
+     * The first capture takes the whole memory, and every next one only the pages written since the previous.
+     * The memory must not be modified behind the back of the CPU in between.
+     */
+    void capture(CPU &cpu);
+
+    /**
+     * @brief Bring a CPU back to the latest state captured at least a number of cycles ago
+     *
+     * The states after it are discarded, so that the history continues from there.
+     *
+     * @retval false If no such state is in the history, then the CPU is not changed
+     */
+    bool rewind(CPU &cpu, size_t cycles);
+
+    /**
+     * @brief Drop the history
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Number of states to rewind to, including the latest one
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @brief Cycle of the oldest state in the history
+     */
+    [[nodiscard]] size_t oldest() const noexcept;
+
+    /**
+     * @brief Number of bytes taken by the differences
+     */
+    [[nodiscard]] size_t bytes() const noexcept;
+
+private:
+    /// @brief Older state, stored as a difference from the next one
+    struct Entry {
+        CPU::Registers registers;
+        size_t cycle    = 0;
+        bool irq_masked = false;
+
+        /// @brief Index of every changed page followed by its compressed difference
+        std::vector<uint8_t> delta;
+    };
+
+    /**
+     * @brief Turn the latest state into the one before it
+     */
+    void apply(const Entry &entry) noexcept;
+
+    /// @brief Drop the newest entry
+    void pop() noexcept;
+
+    size_t _interval;
+
+    size_t _capacity;
+
+    size_t _bytes = 0;
+
+    std::deque<Entry> _entries;
+
+    std::optional<CPU::Snapshot> _latest;
+
+    /// @brief Reused buffer the differences are compressed into
+    std::vector<uint8_t> _scratch;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_REWIND_HPP
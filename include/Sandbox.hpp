@@ -0,0 +1,126 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_SANDBOX_HPP
+#define EMULATOR_MOS_6502_SANDBOX_HPP
+#include "Breakpoints.hpp"
+#include "CPU.hpp"
+#include "Guard.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Reusable environment for running untrusted programs
+ *
+ * A program is called like a subroutine: it starts at its entry point with a return address on the stack,
+ * and it finishes by returning to the exit address. Every call ends with exactly one of the termination reasons,
+ * which only depend on the memory and the limits, so a call can be reproduced.
+ *
+ * The sandbox keeps its CPU and its memory for all the calls. @link reset @endlink only copies back the pages
+ * the previous program wrote to, so that many programs can be run on the same thread one after another with
+ * a setup of microseconds instead of creating a new memory for each of them.
+ */
+class Sandbox {
+public:
+    /// @brief Reason why a call finished
+    enum class Termination : uint8_t {
+        Returned,        ///< The program returned to the exit address
+        Jammed,          ///< The program executed an illegal opcode
+        CycleBudget,     ///< The program spent its cycle budget
+        WriteBudget,     ///< The program attempted a write over its budget
+        AccessViolation, ///< The program attempted an access its region does not permit
+    };
+
+    /// @brief Budgets of a call
+    struct Limits {
+        /// @brief Checked at instruction boundaries, so it may be exceeded by up to 7 cycles
+        size_t cycles = 1'000'000;
+
+        /// @brief Writes of the program, including the pushes onto the stack
+        size_t writes = Guard::unlimited;
+    };
+
+    /// @brief Result of a call
+    struct Outcome {
+        Termination termination;
+        CPU::Registers registers; ///< Registers at the termination
+        size_t cycles = 0;        ///< Number of cycles spent
+        size_t writes = 0;        ///< Number of performed writes
+        std::optional<Guard::Violation> violation;
+    };
+
+    /// @brief Default exit address, it lies in the ROM of the vectors and holds no code
+    static constexpr uint16_t default_exit = 0xFFF0;
+
+    /**
+     * @brief Create a sandbox whose memory is restored to an image before every program
+     *
+     * All the memory is accessible until restricted by @link permit @endlink.
+     *
+     * @param exit Address the program returns to when finished. It needs no execute permission,
+     *             but RTS reads the byte before it, so that page must be readable.
+     */
+    explicit Sandbox(const Memory &image, uint16_t exit = default_exit);
+
+    /**
+     * @brief Set the permissions of a region, replacing the previous ones
+     *
+     * The program needs to read and write the stack page, because JSR, RTS and the interrupts access it,
+     * and to read the page of the exit address.
+     */
+    void permit(uint8_t first_page, uint8_t last_page, std::initializer_list<Access> accesses) noexcept;
+
+    /**
+     * @brief Restore the memory to the image, discarding the program and its results
+     */
+    void reset() noexcept;
+
+    /**
+     * @brief Place the bytes of a program or its input into the memory, bypassing the permissions
+     *
+     * The writes into the ROM have no effect.
+     */
+    void load(uint16_t address, std::span<const uint8_t> bytes) noexcept;
+
+    /**
+     * @brief Run the program at an entry point until it terminates
+     *
+     * The registers are cleared, except for the interrupt-disable flag,
+     * and the stack only holds the return address.
+     */
+    Outcome call(uint16_t entry, const Limits &limits) noexcept;
+
+    /**
+     * @brief Mark the control flow edges taken by the programs
+     *
+     * @see CPU::set_edge_coverage
+     */
+    void set_edge_coverage(EdgeCoverage *edges) noexcept;
+
+    /**
+     * @brief Memory with the results of the last call
+     */
+    [[nodiscard]] const Memory &memory() const noexcept;
+
+private:
+    Memory _image;
+
+    /// @brief CPU is neither copyable nor movable, but the sandbox is movable
+    std::unique_ptr<CPU> _cpu;
+
+    std::unique_ptr<Guard> _guard;
+
+    /// @brief Breakpoint at the exit address
+    std::unique_ptr<Breakpoints> _exit;
+
+    uint16_t _exit_address;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_SANDBOX_HPP
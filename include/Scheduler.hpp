@@ -0,0 +1,177 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_SCHEDULER_HPP
+#define EMULATOR_MOS_6502_SCHEDULER_HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief A memory-mapped device emulated alongside the CPU, e.g. a video, timer or audio chip
+ *
+ * Devices are not ticked every cycle.
+ * Instead, a device keeps the cycle it was last synchronized at and catches up lazily when it is asked to.
+ * This happens when the CPU accesses one of its I/O pages or when an event it has scheduled becomes due.
+ */
+class Device {
+public:
+    virtual ~Device() = default;
+
+    /**
+     * @brief Bring the state of the device up to a given cycle
+     *
+     * This is the place to raise interrupts and to schedule the next event,
+     * which never throws for a device known to the scheduler, see @link Scheduler::add @endlink.
+     * The cycle never decreases between the calls.
+     */
+    virtual void synchronize(size_t cycle) noexcept = 0;
+
+    /**
+     * @brief Read a register of the device
+     *
+     * @pre The device is synchronized with the cycle of the access.
+     */
+    [[nodiscard]] virtual uint8_t read(uint16_t address) noexcept = 0;
+
+    /**
+     * @brief Write a register of the device
+     *
+     * @pre The device is synchronized with the cycle of the access.
+     */
+    virtual void write(uint16_t address, uint8_t value) noexcept = 0;
+};
+
+/**
+ * @brief Timeline of device events keyed by the CPU cycle
+ *
+ * The events are kept in a binary min-heap, so the CPU only has to compare its cycle with the earliest one
+ * after every instruction and runs uninterrupted until it is reached.
+ * Every device known to the scheduler owns a slot in the heap allocated up front, so scheduling an event
+ * never allocates and is safe from the synchronization of a device.
+ * Events are delivered at the first instruction boundary at or after their cycle,
+ * and the device is synchronized with the actual cycle of the delivery.
+ *
+ * The scheduler also maps I/O pages to devices, so that the CPU accesses their registers instead of the memory.
+ */
+class Scheduler {
+public:
+    /// @brief Cycle returned by @link deadline @endlink when nothing is scheduled
+    static constexpr size_t never = std::numeric_limits<size_t>::max();
+
+    Scheduler() noexcept = default;
+
+    /// @brief The events refer to the slots of the devices, so a scheduler cannot be copied
+    Scheduler(const Scheduler &) = delete;
+
+    Scheduler(Scheduler &&) noexcept = default;
+
+    Scheduler &operator=(const Scheduler &) = delete;
+
+    Scheduler &operator=(Scheduler &&) noexcept = default;
+
+    ~Scheduler() noexcept = default;
+
+    /**
+     * @brief Make a device known to the scheduler, so that it can schedule events
+     *
+     * Adding a device again has no effect.
+     *
+     * @param device Must outlive the scheduler
+     * @throws std::bad_alloc If the slot of the device cannot be allocated
+     */
+    void add(Device &device);
+
+    /**
+     * @brief Route the accesses to a range of pages to a device
+     *
+     * The device is added to the scheduler as well, see @link add @endlink.
+     *
+     * @param device Must outlive the scheduler
+     * @throws std::bad_alloc If the slot of the device cannot be allocated
+     */
+    void map(Device &device, uint8_t first_page, uint8_t last_page);
+
+    /**
+     * @brief Route the accesses to a range of pages back to the memory
+     */
+    void unmap(uint8_t first_page, uint8_t last_page) noexcept;
+
+    /**
+     * @brief The device mapped at an address, if any
+     */
+    [[nodiscard]] Device *device(const uint16_t address) const noexcept { return _pages[address >> 8]; }
+
+    /**
+     * @brief Check whether any page is routed to a device
+     */
+    [[nodiscard]] bool mapped() const noexcept;
+
+    /**
+     * @brief Request a device to be synchronized at a given cycle
+     *
+     * Every device has at most one pending event, which is replaced by a new one.
+     *
+     * @retval false If the device is neither added nor mapped, so nothing is scheduled.
+     */
+    bool schedule(Device &device, size_t cycle) noexcept;
+
+    /**
+     * @brief Drop the pending event of a device
+     */
+    void cancel(Device &device) noexcept;
+
+    /**
+     * @brief The cycle of the earliest pending event
+     */
+    [[nodiscard]] size_t deadline() const noexcept { return _heap.empty() ? never : _heap.front().cycle; }
+
+    /**
+     * @brief Synchronize all the devices whose events are due
+     *
+     * The devices might schedule new events while being synchronized, they are delivered as well if already due.
+     */
+    void dispatch(size_t cycle) noexcept;
+
+private:
+    /// @brief Position in the heap of a device without a pending event
+    static constexpr size_t idle = std::numeric_limits<size_t>::max();
+
+    struct Event {
+        size_t cycle;
+        Device *device;
+        size_t *position; ///< Where the device keeps the index of its event in the heap
+    };
+
+    /**
+     * @brief Put an event at an index of the heap and let its device know
+     */
+    void place(size_t index, const Event &event) noexcept;
+
+    /**
+     * @brief Move an event whose cycle changed to its place in the heap
+     */
+    void restore_heap(size_t index) noexcept;
+
+    /**
+     * @brief Take an event out of the heap
+     */
+    void remove(size_t index) noexcept;
+
+    /// @brief Device mapped at every page, or null for the memory
+    std::array<Device *, 0x100> _pages{};
+
+    /// @brief Min-heap of events by the cycle, with the capacity for an event of every known device
+    std::vector<Event> _heap;
+
+    /// @brief Index of the pending event of every known device, or @link idle @endlink
+    std::unordered_map<Device *, size_t> _positions;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_SCHEDULER_HPP
@@ -0,0 +1,144 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_SEARCH_HPP
+#define EMULATOR_MOS_6502_SEARCH_HPP
+#include "CPU.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_set>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief What a search looks for, judged by the contents of the memory
+ *
+ * The methods are called concurrently by all the workers of the search, so they must not modify shared state.
+ */
+class Objective {
+public:
+    virtual ~Objective() noexcept = default;
+
+    /**
+     * @brief Whether a state is the one searched for
+     */
+    [[nodiscard]] virtual bool goal(const Memory &memory) const noexcept = 0;
+
+    /**
+     * @brief How promising a state is, the higher the better
+     *
+     * Only used to choose the states kept by a search with a limited beam.
+     */
+    [[nodiscard]] virtual int64_t score(const Memory &) const noexcept { return 0; }
+};
+
+/**
+ * @brief Breadth-first search for a sequence of inputs that brings a program to a goal
+ *
+ * An input is a byte that the host puts into the memory at a fixed address, after which the program runs for a frame
+ * of a fixed number of cycles. Every state of the frontier is forked for each candidate input, and all the forks
+ * of a level are executed in parallel, each worker restoring the snapshot of the parent into its own CPU.
+ *
+ * States reached by different sequences are detected by @link CPU::digest @endlink. The workers only look up
+ * the states of the previous levels, and the new states of a level are added in the order of its forks after
+ * they are all executed, so the first fork reaching a state is kept regardless of the scheduling.
+ * With a limited beam, only the states with the best scores proceed to the next level,
+ * otherwise the search is exhaustive and finds a shortest sequence.
+ *
+ * The programs are executed without devices, so they must only depend on the memory and the inputs.
+ */
+class Search {
+public:
+    struct Options {
+        uint16_t input = 0;              ///< Address the inputs are written to
+        std::vector<uint8_t> candidates; ///< Values tried as the input of every frame
+        size_t frame     = 1'000;        ///< Number of cycles executed after every input
+        size_t depth     = 10;           ///< Maximal length of the sequence
+        size_t beam      = 0;            ///< Number of states kept at every level, zero means all of them
+        unsigned threads = 0;            ///< Number of workers, zero means the number of hardware threads
+    };
+
+    struct Result {
+        bool found = false;
+        std::vector<uint8_t> inputs;        ///< Sequence leading to the goal, if found
+        std::optional<CPU::Snapshot> state; ///< State that satisfied the goal, if found
+        size_t states     = 0;              ///< Number of distinct states reached, including the start
+        size_t duplicates = 0;              ///< Number of forks that reached a known state
+    };
+
+    explicit Search(Options options) noexcept;
+
+    /**
+     * @brief Search from a state until the goal is reached or the depth is exhausted
+     */
+    [[nodiscard]] Result run(const CPU::Snapshot &start, const Objective &objective);
+
+private:
+    /// @brief Step of a sequence: the input and the step before it
+    struct Trail {
+        size_t parent; ///< Index of the previous step, or @link root @endlink
+        uint8_t input;
+    };
+
+    /// @brief State of the frontier
+    struct Node {
+        CPU::Snapshot state;
+        size_t trail; ///< Index of the last step leading to the state
+        int64_t score = 0;
+    };
+
+    /// @brief Parent of the first step
+    static constexpr size_t root = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Fork every state of the frontier for every candidate and keep the new states
+     *
+     * @return Index of the first fork that reached the goal, if any
+     */
+    std::optional<size_t> expand(const Objective &objective);
+
+    /**
+     * @brief Execute the forks of the level in a worker's own CPU, taking their indices from a shared counter
+     *
+     * The first exception is kept for @link expand @endlink to rethrow, and it stops all the workers.
+     */
+    void work(CPU &cpu, const Objective &objective) noexcept;
+
+    Options _options;
+
+    std::vector<Node> _frontier;
+
+    /// @brief Forks of the current level, indexed by frontier state and candidate
+    std::vector<std::optional<Node>> _forks;
+
+    /// @brief Whether each fork reached the goal
+    std::vector<uint8_t> _reached;
+
+    /// @brief Digest of the state reached by each fork
+    std::vector<uint64_t> _digests;
+
+    std::vector<Trail> _trails;
+
+    /// @brief Digests of the reached states, only read by the workers
+    std::unordered_set<uint64_t> _table;
+
+    /// @brief Index of the next fork to execute
+    std::atomic<size_t> _next = 0;
+
+    size_t _duplicates = 0;
+
+    std::mutex _failure_mutex;
+
+    /// @brief First exception thrown by a worker
+    std::exception_ptr _failure;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_SEARCH_HPP
@@ -0,0 +1,168 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_SINGLE_STEP_HPP
+#define EMULATOR_MOS_6502_SINGLE_STEP_HPP
+#include "CPU.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Test case of the SingleStepTests (ProcessorTests) corpus
+ *
+ * Every case executes a single instruction from a random state, and lists the state after it
+ * together with every bus cycle the hardware performs.
+ */
+struct SingleStepTest {
+    /// @brief State of the registers and of the memory bytes that matter to the instruction
+    struct State {
+        CPU::Registers registers;
+        std::vector<std::pair<uint16_t, uint8_t>> ram; ///< Address and value of every listed byte
+    };
+
+    /// @brief Bus activity during a single clock cycle
+    struct Cycle {
+        uint16_t address = 0;
+        uint8_t value    = 0;
+        Access access    = Access::Read; ///< Either a read or a write, the fetches are reads as well
+
+        bool operator==(const Cycle &) const noexcept = default;
+    };
+
+    std::string_view name; ///< Points into the parsed text
+    State initial;
+    State final;
+    std::vector<Cycle> cycles;
+};
+
+/**
+ * @brief Streaming parser of a test file, which is a JSON array of cases
+ *
+ * The cases are decoded one at a time straight from the text into a reused object, without building a document,
+ * so that a mapped file of 10,000 cases is processed without any allocation once the vectors have grown.
+ * Only the fields of the format are decoded, the unknown ones are skipped.
+ */
+class SingleStepReader {
+public:
+    /**
+     * @param text Whole contents of a file, must outlive the reader and the parsed cases
+     */
+    explicit SingleStepReader(std::string_view text) noexcept;
+
+    /**
+     * @brief Parse the next case
+     *
+     * @retval false If there are no more cases or the text is malformed, see @link failed @endlink
+     */
+    [[nodiscard]] bool next(SingleStepTest &test);
+
+    /**
+     * @brief Whether the parsing stopped at malformed text
+     */
+    [[nodiscard]] bool failed() const noexcept;
+
+    /**
+     * @brief Offset of the parser in the text, e.g. of the error
+     */
+    [[nodiscard]] size_t position() const noexcept;
+
+private:
+    void skip_whitespace() noexcept;
+
+    /// @brief Skip the whitespace and check the next character without consuming it
+    [[nodiscard]] bool peek(char c) noexcept;
+
+    /// @brief Skip the whitespace and consume an expected character
+    [[nodiscard]] bool consume(char c) noexcept;
+
+    [[nodiscard]] bool string(std::string_view &value) noexcept;
+
+    /// @brief Parse a non-negative integer that fits into a given maximum
+    [[nodiscard]] bool integer(unsigned &value, unsigned maximum) noexcept;
+
+    /// @brief Skip a value of any type
+    [[nodiscard]] bool skip() noexcept;
+
+    [[nodiscard]] bool state(SingleStepTest::State &state);
+
+    [[nodiscard]] bool cycles(std::vector<SingleStepTest::Cycle> &cycles);
+
+    [[nodiscard]] bool test(SingleStepTest &test);
+
+    std::string_view _text;
+
+    size_t _position = 0;
+
+    bool _started = false;
+
+    bool _finished = false;
+
+    bool _failed = false;
+};
+
+/**
+ * @brief Executor of SingleStepTests cases on a @link CPU @endlink
+ *
+ * All the pages are mapped to a device that stands for the memory and logs every access,
+ * so that the bus cycles are compared one by one. The memory is cleared after every case by zeroing only the bytes
+ * that the case touched, so a runner is reused for any number of cases.
+ */
+class SingleStepRunner {
+public:
+    /// @brief Outcome of a case
+    enum class Result : uint8_t {
+        Passed,
+        Failed,
+        Unsupported, ///< The opcode is not implemented by the CPU, so the case is not executed
+    };
+
+    SingleStepRunner();
+
+    SingleStepRunner(const SingleStepRunner &) = delete;
+
+    SingleStepRunner &operator=(const SingleStepRunner &) = delete;
+
+    /**
+     * @brief Execute a case and compare the registers, the listed memory and the bus cycles with the expected ones
+     *
+     * Bits 4 and 5 of the status register do not exist in hardware, so they are not compared.
+     */
+    Result run(const SingleStepTest &test);
+
+    /**
+     * @brief Description of the mismatches of the last failed case
+     */
+    [[nodiscard]] const std::string &failure() const noexcept;
+
+private:
+    /// @brief Memory of the runner that logs every access
+    class Bus final : public Device {
+    public:
+        void synchronize(size_t) noexcept override {}
+
+        [[nodiscard]] uint8_t read(uint16_t address) noexcept override;
+
+        void write(uint16_t address, uint8_t value) noexcept override;
+
+        Memory::Data ram{};
+
+        std::vector<SingleStepTest::Cycle> log;
+    };
+
+    Bus _bus;
+
+    Scheduler _scheduler;
+
+    CPU _cpu;
+
+    std::string _failure;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_SINGLE_STEP_HPP
@@ -4,6 +4,7 @@
 
 #ifndef EMULATOR_MOS_6502_STATUS_REGISTER_HPP
 #define EMULATOR_MOS_6502_STATUS_REGISTER_HPP
+#include <cstdint>
 
 namespace emulator::mos_6502 {
 struct StatusRegister {
@@ -66,6 +67,33 @@ struct StatusRegister {
      * Any comparison updates this additionally to the Z and N flags, as do shift and rotate operations.
      */
     bool carry : 1 = false;
+
+    /**
+     * @brief Pack the flags into a byte as it is pushed onto the stack
+     *
+     * The bits from the highest to the lowest are N, V, -, B, D, I, Z, C.
+     * The layout of the bit-fields themselves is implementation-defined, so the conversion is done explicitly.
+     */
+    [[nodiscard]] constexpr uint8_t to_byte() const noexcept {
+        return static_cast<uint8_t>(negative << 7 | overflow << 6 | expansion << 5 | break_ << 4 | decimal << 3
+                                    | interrupt << 2 | zero << 1 | static_cast<int>(carry));
+    }
+
+    /**
+     * @brief Unpack the flags from a byte as it is pulled from the stack
+     *
+     * @copydetails to_byte
+     */
+    [[nodiscard]] static constexpr StatusRegister from_byte(const uint8_t byte) noexcept {
+        return { .negative  = (byte & 0x80) != 0,
+                 .overflow  = (byte & 0x40) != 0,
+                 .expansion = (byte & 0x20) != 0,
+                 .break_    = (byte & 0x10) != 0,
+                 .decimal   = (byte & 0x08) != 0,
+                 .interrupt = (byte & 0x04) != 0,
+                 .zero      = (byte & 0x02) != 0,
+                 .carry     = (byte & 0x01) != 0 };
+    }
 };
 } // namespace emulator::mos_6502
 
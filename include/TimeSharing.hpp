@@ -0,0 +1,116 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_TIME_SHARING_HPP
+#define EMULATOR_MOS_6502_TIME_SHARING_HPP
+#include "CPU.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Cooperative multiplexer of many CPU contexts on the calling thread
+ *
+ * The contexts are switched every quantum of cycles, like green threads: a switch is only a return from
+ * @link CPU::run @endlink and a call for another instance, without any OS context switch.
+ *
+ * The share of the cycles follows the priorities by stride scheduling.
+ * Every context has a virtual time that advances by the cycles it consumed divided by its priority,
+ * and the context with the earliest virtual time runs next.
+ * So a context with priority 2 gets twice as many cycles as one with priority 1, and contexts of equal priority
+ * take turns. A context added later starts at the current virtual time instead of catching up.
+ *
+ * Every context may also have a quota: once it has consumed that many cycles, it is not scheduled anymore
+ * until the quota is raised.
+ */
+class TimeSharing {
+public:
+    /// @brief Quota of the contexts that may run forever
+    static constexpr size_t unlimited = std::numeric_limits<size_t>::max();
+
+    /// @brief Scheduling state of a context
+    enum class State : uint8_t {
+        Ready,     ///< Waiting for its next quantum
+        Exhausted, ///< Consumed its quota
+        Stopped,   ///< Its execution stopped, see @link CPU::run @endlink
+    };
+
+    /**
+     * @param quantum Number of cycles a context runs before switching to another one
+     */
+    explicit TimeSharing(size_t quantum = 1'000) noexcept;
+
+    /**
+     * @brief Add a context
+     *
+     * @param cpu The instance, ready to be executed
+     * @param priority Weight of the context in the share of the cycles, at least 1
+     * @param quota Number of cycles the context may consume
+     * @return Index of the context
+     */
+    size_t spawn(std::unique_ptr<CPU> cpu, unsigned priority = 1, size_t quota = unlimited);
+
+    /**
+     * @brief Run the next context for a quantum
+     *
+     * @retval false If no context is ready.
+     */
+    bool step() noexcept;
+
+    /**
+     * @brief Run until no context is ready
+     */
+    void run() noexcept;
+
+    /**
+     * @brief Change the quota of a context, making an exhausted context ready again if it is raised
+     */
+    void set_quota(size_t context, size_t quota);
+
+    /**
+     * @brief Access the instance of a context, e.g. to raise an interrupt between the quanta
+     */
+    [[nodiscard]] CPU &instance(size_t context) noexcept;
+
+    [[nodiscard]] State state(size_t context) const noexcept;
+
+    /**
+     * @brief Number of cycles consumed by a context
+     */
+    [[nodiscard]] size_t consumed(size_t context) const noexcept;
+
+private:
+    struct Context {
+        std::unique_ptr<CPU> cpu;
+        unsigned priority = 1;
+        size_t quota      = unlimited;
+        size_t consumed   = 0;
+        uint64_t pass     = 0; ///< Virtual time of the next quantum
+        State state       = State::Ready;
+    };
+
+    /// @brief Virtual time advance of a cycle consumed at priority 1
+    static constexpr uint64_t stride = uint64_t{ 1 } << 20;
+
+    /**
+     * @brief Put a ready context into the heap
+     */
+    void enqueue(size_t context);
+
+    std::vector<Context> _contexts;
+
+    /// @brief Min-heap of the ready contexts by the virtual time, the ties are broken by the index
+    std::vector<size_t> _ready;
+
+    /// @brief Virtual time of the last quantum
+    uint64_t _now = 0;
+
+    size_t _quantum;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_TIME_SHARING_HPP
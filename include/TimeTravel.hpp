@@ -0,0 +1,94 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_TIME_TRAVEL_HPP
+#define EMULATOR_MOS_6502_TIME_TRAVEL_HPP
+#include "Journal.hpp"
+#include "WriteLog.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Debugger session that moves a CPU to any cycle of its history, forwards and backwards
+ *
+ * The session records the execution into a @link Journal @endlink with a snapshot every given number of cycles.
+ * Going back restores the closest snapshot and re-executes the rest of the way deterministically,
+ * so any point of the history is reached within one interval of execution.
+ * Going forward past the furthest recorded cycle, called the frontier, continues the live execution and its recording.
+ *
+ * All the memory writes are also logged into a @link WriteLog @endlink,
+ * which answers which write to an address happened last before a cycle without executing anything.
+ */
+class TimeTravel {
+public:
+    /**
+     * @brief Attach the journal and the write log to a CPU and start recording from its current state
+     *
+     * @param cpu Must outlive the session, its journal and write log must not be replaced meanwhile
+     * @param interval Number of cycles between the snapshots
+     */
+    TimeTravel(CPU &cpu, size_t interval);
+
+    TimeTravel(const TimeTravel &) = delete;
+
+    TimeTravel &operator=(const TimeTravel &) = delete;
+
+    /**
+     * @brief Detach the journal and the write log from the CPU
+     */
+    ~TimeTravel() noexcept;
+
+    /**
+     * @brief Execute a single instruction, replaying it if it was already recorded
+     *
+     * @copydoc CPU::step
+     */
+    bool step();
+
+    /**
+     * @brief Move to the first instruction boundary at or after a cycle
+     *
+     * @retval false If the CPU stopped before reaching the cycle
+     */
+    bool seek(size_t cycle);
+
+    /**
+     * @brief Move back to the start of the previous instruction
+     *
+     * @retval false If the CPU is at the start of the history, or if it stopped while re-executing the way there,
+     *              e.g. at a breakpoint or a guard violation
+     */
+    bool reverse_step();
+
+    /**
+     * @copydoc WriteLog::last_write
+     */
+    [[nodiscard]] std::optional<WriteLog::Write> last_write(uint16_t address, size_t cycle) const noexcept;
+
+    /**
+     * @brief The furthest cycle reached, up to which the history is recorded
+     */
+    [[nodiscard]] size_t frontier() const noexcept;
+
+    [[nodiscard]] const Journal &journal() const noexcept;
+
+    [[nodiscard]] const WriteLog &write_log() const noexcept;
+
+private:
+    CPU &_cpu;
+
+    Journal _journal;
+
+    WriteLog _write_log;
+
+    /// @brief Cycle the recording started at
+    size_t _origin;
+
+    size_t _frontier;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_TIME_TRAVEL_HPP
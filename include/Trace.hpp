@@ -0,0 +1,111 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_TRACE_HPP
+#define EMULATOR_MOS_6502_TRACE_HPP
+#include "CPU.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief State of the CPU right before an instruction is executed
+ *
+ * A binary trace is a plain sequence of such records in the host byte order without any header,
+ * so that it can be mapped into memory and reinterpreted as an array.
+ */
+struct TraceRecord {
+    uint64_t cycle = 0; ///< Number of cycles elapsed before the instruction
+    uint16_t PC    = 0;
+    uint8_t A      = 0;
+    uint8_t X      = 0;
+    uint8_t Y      = 0;
+    uint8_t P      = 0; ///< Status register as it would be pushed by hardware, i.e. with bit 5 set and no break flag
+    uint8_t SP     = 0;
+    uint8_t opcode = 0; ///< Opcode at PC
+
+    /**
+     * @brief Take a record of the CPU state before it executes the next instruction
+     */
+    [[nodiscard]] static TraceRecord capture(const CPU &cpu) noexcept;
+
+    /**
+     * @brief Parse a line of a reference log in the format of nestest.log
+     *
+     * Only the address, the opcode and the register columns are used:
+     * @code{text}
+     * C000  4C F5 C5  JMP $C5F5                       A:00 X:00 Y:00 P:24 SP:FD PPU:  0, 21 CYC:7
+     * @endcode
+     *
+     * @retval std::nullopt If any of the fields is missing or malformed
+     */
+    [[nodiscard]] static std::optional<TraceRecord> parse_reference(std::string_view line) noexcept;
+
+    /**
+     * @brief Check whether this record agrees with a reference one
+     *
+     * Bits 4 and 5 of the status register do not exist in hardware, so they are not compared.
+     */
+    [[nodiscard]] bool matches(const TraceRecord &reference) const noexcept;
+
+    /**
+     * @brief List the fields that do not agree with a reference record
+     *
+     * @return Space-separated field names, or an empty string if the records match
+     */
+    [[nodiscard]] std::string mismatches(const TraceRecord &reference) const;
+};
+
+static_assert(sizeof(TraceRecord) == 16, "The binary trace format must not depend on the padding");
+
+/**
+ * @brief Print a record in the register format of nestest.log
+ */
+std::ostream &operator<<(std::ostream &stream, const TraceRecord &record);
+
+/**
+ * @brief Buffered writer of binary traces
+ */
+class TraceWriter {
+public:
+    explicit TraceWriter(const std::filesystem::path &path) noexcept;
+
+    TraceWriter(const TraceWriter &) = delete;
+
+    TraceWriter &operator=(const TraceWriter &) = delete;
+
+    ~TraceWriter() noexcept;
+
+    /**
+     * @brief Append the state of the CPU before it executes the next instruction
+     */
+    void record(const CPU &cpu) noexcept;
+
+    /**
+     * @brief Write all the buffered records to the file
+     */
+    void flush() noexcept;
+
+    /**
+     * @retval false If the file could not be opened or any write failed
+     */
+    [[nodiscard]] bool good() const noexcept;
+
+private:
+    /// @brief Number of records accumulated before they are written at once
+    static constexpr size_t buffer_size = 4096;
+
+    std::ofstream _stream;
+
+    std::vector<TraceRecord> _buffer;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_TRACE_HPP
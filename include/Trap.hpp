@@ -0,0 +1,42 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_TRAP_HPP
+#define EMULATOR_MOS_6502_TRAP_HPP
+#include "CPU.hpp"
+#include <cstddef>
+#include <cstdint>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief End of a self-checking program, such as the functional tests of Klaus Dormann
+ *
+ * Such programs signal both the success and the failures by trapping: they execute a @p JMP to itself
+ * or a branch to itself, which loops forever. The address of the trap tells which test failed, and a known address
+ * stands for the success. A trap is recognized by a jump or a branch that did not change the program counter,
+ * which takes a couple of comparisons per instruction.
+ */
+struct Trap {
+    /// @brief Way the program stopped
+    enum class Kind : uint8_t {
+        Loop,    ///< An instruction jumped or branched to itself
+        Stopped, ///< The CPU stopped, e.g. at an illegal opcode
+        Limit,   ///< The cycle limit was reached before any trap
+    };
+
+    Kind kind;
+    uint16_t PC         = 0; ///< Address of the trapping instruction
+    size_t cycles       = 0; ///< Number of cycles spent, including the trapping instruction
+    size_t instructions = 0; ///< Number of executed instructions, including the trapping one
+
+    /**
+     * @brief Run a CPU until it traps
+     *
+     * @param limit Budget of cycles, checked at instruction boundaries
+     */
+    [[nodiscard]] static Trap wait(CPU &cpu, size_t limit) noexcept;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_TRAP_HPP
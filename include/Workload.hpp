@@ -0,0 +1,52 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_WORKLOAD_HPP
+#define EMULATOR_MOS_6502_WORKLOAD_HPP
+#include "Memory.hpp"
+#include <cstdint>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Generated benchmark program dominated by a single class of instructions
+ *
+ * The image is a whole address space whose reset vector points at the entry, so it runs both after a reset
+ * and from the entry directly. The program ends by trapping in a @p JMP to itself, see @link Trap @endlink,
+ * and its results are known in advance, so that a run is both timed and checked.
+ *
+ * The data of the programs comes from a fixed seed and the raw output of @p std::mt19937,
+ * so the images are the same with every standard library.
+ */
+struct Workload {
+    std::string_view name;
+    std::string_view description; ///< What the program exercises
+    Memory::Data image{};
+    uint16_t entry = 0;
+    uint16_t trap  = 0; ///< Address of the final @p JMP to itself
+
+    /// @brief Address and value of every byte whose final value is known, including all the results
+    std::vector<std::pair<uint16_t, uint8_t>> expected;
+
+    /**
+     * @brief Generate all the workloads
+     *
+     * - memory: copying and filling pages with the indirect-indexed loads and stores,
+     * - decimal: BCD counters updated by ADC and SBC in the decimal mode,
+     * - sort: bubble sort, dominated by compares and conditional branches,
+     * - list: a walk over a shuffled linked list through zero-page pointers,
+     * - recursion: recursive Fibonacci numbers and deep chains of JSR and RTS on the stack page.
+     */
+    [[nodiscard]] static std::vector<Workload> all();
+
+    /**
+     * @brief Whether a memory holds the expected final values
+     */
+    [[nodiscard]] bool verify(const Memory &memory) const noexcept;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_WORKLOAD_HPP
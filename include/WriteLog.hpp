@@ -0,0 +1,89 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#ifndef EMULATOR_MOS_6502_WRITE_LOG_HPP
+#define EMULATOR_MOS_6502_WRITE_LOG_HPP
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <vector>
+
+namespace emulator::mos_6502 {
+/**
+ * @brief Log of the memory writes of a CPU indexed by the address
+ *
+ * Every address has its own list of writes in the order of their cycles,
+ * so the last write to an address before a cycle is found by a binary search without executing anything.
+ *
+ * Only the writes after the last logged one are taken. A deterministic re-execution of the past,
+ * e.g. after seeking backwards in a @link Journal @endlink, repeats the same writes, so they are not logged twice.
+ *
+ * Logging never throws, since the CPU does it on its bus. If the log cannot grow, it stops taking writes
+ * and @link overflowed @endlink is set, so it stays complete up to @link end @endlink.
+ */
+class WriteLog {
+public:
+    /// @brief A logged write
+    struct Write {
+        size_t cycle  = 0; ///< Cycle of the bus access
+        uint8_t value = 0;
+
+        bool operator==(const Write &) const noexcept = default;
+    };
+
+    WriteLog();
+
+    /**
+     * @brief Log a write performed by the CPU, unless it is not newer than the last logged one
+     */
+    void record(const size_t cycle, const uint16_t address, const uint8_t value) noexcept {
+        if (_overflowed || (_size != 0 && cycle <= _end)) return;
+        try {
+            _writes[address].push_back({ .cycle = cycle, .value = value });
+        } catch (const std::bad_alloc &) {
+            _overflowed = true;
+            return;
+        }
+        _end = cycle;
+        ++_size;
+    }
+
+    /**
+     * @brief Find the last write to an address strictly before a cycle
+     */
+    [[nodiscard]] std::optional<Write> last_write(uint16_t address, size_t cycle) const noexcept;
+
+    /**
+     * @brief All the writes to an address in the order of their cycles
+     */
+    [[nodiscard]] const std::vector<Write> &writes(uint16_t address) const noexcept;
+
+    /**
+     * @brief Total number of logged writes
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @brief Cycle of the last logged write
+     */
+    [[nodiscard]] size_t end() const noexcept;
+
+    /**
+     * @brief Whether the log stopped taking writes because it could not grow
+     */
+    [[nodiscard]] bool overflowed() const noexcept;
+
+private:
+    std::vector<std::vector<Write>> _writes;
+
+    size_t _size = 0;
+
+    size_t _end = 0;
+
+    bool _overflowed = false;
+};
+} // namespace emulator::mos_6502
+
+#endif //EMULATOR_MOS_6502_WRITE_LOG_HPP
@@ -4,9 +4,7 @@
 #include <thread>
 
 void emulate(const std::chrono::nanoseconds clock_period, const std::chrono::nanoseconds time) {
-    emulator::mos_6502::Memory::Data data{};
-    std::ranges::fill(data, 0);
-    emulator::mos_6502::CPU cpu{ clock_period, emulator::mos_6502::Memory{ data } }; // executes as fast as it can
+    emulator::mos_6502::CPU cpu{ clock_period, emulator::mos_6502::Memory{} }; // executes as fast as it can
 
     std::jthread thread{ [&cpu] { cpu.start(); } };
     std::this_thread::sleep_for(time);
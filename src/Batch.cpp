@@ -0,0 +1,118 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Batch.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+
+namespace emulator::mos_6502 {
+Batch::Batch(const unsigned threads, const size_t slice) : _slice(std::max<size_t>(slice, 1)) {
+    const auto count = threads != 0 ? threads : std::max(std::thread::hardware_concurrency(), 1u);
+    for (unsigned i = 0; i < count; ++i) _queues.push_back(std::make_unique<Queue>());
+}
+
+size_t Batch::add(std::unique_ptr<CPU> cpu, const size_t budget) {
+    const auto start = cpu->cycle();
+    _tasks.push_back({ .cpu = std::move(cpu), .start = start, .end = start + budget });
+    return _tasks.size() - 1;
+}
+
+std::vector<Batch::Result> Batch::run() {
+    // Distribute the instances evenly, the stealing takes care of the imbalance
+    for (const auto &queue : _queues) queue->tasks.clear(); // a failed run may leave some behind
+    size_t remaining = 0;
+    for (size_t i = 0; i < _tasks.size(); ++i)
+        if (_tasks[i].cpu->cycle() < _tasks[i].end && !_tasks[i].stopped)
+            _queues[remaining++ % _queues.size()]->tasks.push_back(i);
+    _remaining = remaining;
+    _failed    = false;
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(_queues.size() - 1);
+        for (size_t i = 1; i < _queues.size(); ++i) workers.emplace_back([this, i] { work(i); });
+        work(0);
+    }
+    if (_failure) std::rethrow_exception(std::exchange(_failure, nullptr));
+
+    std::vector<Result> results;
+    results.reserve(_tasks.size());
+    for (const auto &task : _tasks)
+        results.push_back({ .registers = task.cpu->registers(),
+                            .cycles    = task.cpu->cycle() - task.start,
+                            .stopped   = task.stopped });
+    return results;
+}
+
+const CPU &Batch::instance(const size_t index) const noexcept { return *_tasks[index].cpu; }
+
+size_t Batch::size() const noexcept { return _tasks.size(); }
+
+void Batch::work(const size_t worker) noexcept {
+    auto &own = *_queues[worker];
+    try {
+        while (true) {
+            // The version is read first, so that a task put back after the queues were found empty wakes the worker
+            const auto version = _version.load(std::memory_order_acquire);
+            if (_remaining.load(std::memory_order_acquire) == 0 || _failed.load(std::memory_order_relaxed)) break;
+            const auto index = take(worker);
+            if (index == _tasks.size()) {
+                // The remaining tasks are being executed by other workers, which may put them back
+                _version.wait(version, std::memory_order_acquire);
+                continue;
+            }
+
+            auto &task         = _tasks[index];
+            const auto current = task.cpu->cycle();
+            task.stopped       = !task.cpu->run(std::min(_slice, task.end - current));
+            if (task.stopped || task.cpu->cycle() >= task.end) {
+                _remaining.fetch_sub(1, std::memory_order_release);
+                _version.fetch_add(1, std::memory_order_release);
+                _version.notify_all();
+                continue;
+            }
+
+            {
+                const std::scoped_lock lock(own.mutex);
+                own.tasks.push_back(index);
+            }
+            _version.fetch_add(1, std::memory_order_release);
+            _version.notify_one();
+        }
+    } catch (...) {
+        {
+            const std::scoped_lock lock(_failure_mutex);
+            if (!_failure) _failure = std::current_exception();
+        }
+        _failed = true; // the other workers stop after their current slice
+        _version.fetch_add(1, std::memory_order_release);
+        _version.notify_all();
+    }
+}
+
+size_t Batch::take(const size_t worker) noexcept {
+    {
+        auto &own = *_queues[worker];
+        const std::scoped_lock lock(own.mutex);
+        if (!own.tasks.empty()) {
+            const auto index = own.tasks.back();
+            own.tasks.pop_back();
+            return index;
+        }
+    }
+
+    for (size_t offset = 1; offset < _queues.size(); ++offset) {
+        auto &victim = *_queues[(worker + offset) % _queues.size()];
+        const std::scoped_lock lock(victim.mutex);
+        if (!victim.tasks.empty()) {
+            const auto index = victim.tasks.front();
+            victim.tasks.pop_front();
+            return index;
+        }
+    }
+    return _tasks.size();
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,63 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Breakpoints.hpp"
+
+#include <algorithm>
+
+namespace emulator::mos_6502 {
+void Breakpoints::add(const Access access, const uint16_t address, const std::optional<uint8_t> value) {
+    _entries.push_back({ .access = access, .address = address, .value = value });
+    update_page(access, address);
+}
+
+void Breakpoints::remove(const Access access, const uint16_t address) noexcept {
+    std::erase_if(_entries, [=](const Entry &entry) { return entry.access == access && entry.address == address; });
+    update_page(access, address);
+}
+
+void Breakpoints::clear() noexcept {
+    _entries.clear();
+    for (auto &pages : _pages) pages.fill(0);
+    _hit.reset();
+    _resumed.reset();
+}
+
+bool Breakpoints::before_instruction(const uint16_t pc, const uint8_t opcode) noexcept {
+    if (!watched(Access::Execute, pc)) return false;
+
+    if (_resumed == pc) { // the CPU has already stopped here, so the instruction is executed this time
+        _resumed.reset();
+        return false;
+    }
+
+    match(Access::Execute, pc, opcode);
+    if (!_hit) return false;
+
+    _resumed = pc;
+    return true;
+}
+
+const std::optional<Breakpoints::Hit> &Breakpoints::hit() const noexcept { return _hit; }
+
+void Breakpoints::match(const Access access, const uint16_t address, const uint8_t value) noexcept {
+    if (_hit) return; // the first hit of an instruction is reported
+
+    const bool matches = std::ranges::any_of(_entries, [=](const Entry &entry) {
+        return entry.access == access && entry.address == address && (!entry.value || entry.value == value);
+    });
+    if (matches) _hit = Hit{ .access = access, .address = address, .value = value };
+}
+
+void Breakpoints::update_page(const Access access, const uint16_t address) noexcept {
+    const auto page      = address >> 8;
+    const bool has_entry = std::ranges::any_of(_entries, [=](const Entry &entry) {
+        return entry.access == access && entry.address >> 8 == page;
+    });
+
+    auto &word = _pages[static_cast<size_t>(access)][page >> 6];
+    if (has_entry) word |= uint64_t{ 1 } << (page & 63);
+    else word &= ~(uint64_t{ 1 } << (page & 63));
+}
+} // namespace emulator::mos_6502
@@ -2,11 +2,60 @@
 // Created by Mikhail Tsaritsyn on Apr 02, 2025.
 //
 #include "CPU.hpp"
+#include "Journal.hpp"
+
+#include <array>
 #include <chrono>
+#include <limits>
+#include <utility>
 
 namespace emulator::mos_6502 {
+namespace {
+/**
+ * @brief Decoded opcode
+ */
+struct Operation {
+    Instruction instruction;
+    Addressing addressing;
+};
+
+/**
+ * @brief Decoding table for all the opcodes, so that the decoding is not repeated for every executed instruction
+ */
+const std::array<std::optional<Operation>, 256> operations = [] {
+    std::array<std::optional<Operation>, 256> result{};
+    for (size_t opcode = 0; opcode < result.size(); ++opcode) {
+        const auto instruction = getInstruction(static_cast<uint8_t>(opcode));
+        const auto addressing  = getAddressing(static_cast<uint8_t>(opcode));
+        if (instruction && addressing) result[opcode] = Operation{ *instruction, *addressing };
+    }
+    return result;
+}();
+
+/**
+ * @brief Whether an instruction decides which address is executed next, so that its outcome is a coverage edge
+ */
+constexpr bool transfers_control(const Instruction instruction) noexcept {
+    switch (instruction) {
+    case Instruction::BCC:
+    case Instruction::BCS:
+    case Instruction::BNE:
+    case Instruction::BEQ:
+    case Instruction::BPL:
+    case Instruction::BMI:
+    case Instruction::BVC:
+    case Instruction::BVS:
+    case Instruction::JMP:
+    case Instruction::JSR:
+    case Instruction::RTS:
+    case Instruction::RTI:
+    case Instruction::BRK: return true;
+    default: return false;
+    }
+}
+} // namespace
 
-CPU::CPU(const std::chrono::nanoseconds clock_period, const Memory &memory) noexcept
+CPU::CPU(const std::chrono::nanoseconds clock_period, const Memory &memory)
         : _clock(clock_period),
           _memory(memory) {}
 
@@ -15,16 +64,16 @@ void CPU::start() noexcept {
 
     auto prev_time = std::chrono::high_resolution_clock::now();
     static constexpr size_t window = 100;
-    while (!_terminate.test()) {
-        read(PC++);
-
+    size_t window_start            = _cycle;
+    while (!_terminate.test() && step()) {
         // Estimate the clock frequency using the last 100 pulses
         // TODO: Move to a separate function?
-        if (_cycle % window == 0) {
+        if (_cycle - window_start >= window) {
             const auto current_time                     = std::chrono::high_resolution_clock::now();
             const std::chrono::duration<double> delta_t = current_time - prev_time;
-            _frequency                                  = static_cast<double>(window) / delta_t.count();
+            _frequency                                  = static_cast<double>(_cycle - window_start) / delta_t.count();
             prev_time                                   = current_time;
+            window_start                                = _cycle;
         }
     }
 
@@ -35,32 +84,279 @@ void CPU::start() noexcept {
     }
 }
 
+bool CPU::run(const size_t cycles) noexcept {
+    const auto end = _cycle + cycles;
+    while (_cycle < end)
+        if (_terminate.test() || !step(end)) return false;
+    return true;
+}
+
 void CPU::terminate() noexcept { _terminate.test_and_set(); }
 
+void CPU::assert_irq(const unsigned source) noexcept { _irq_lines.fetch_or(uint32_t{ 1 } << source); }
+
+void CPU::release_irq(const unsigned source) noexcept { _irq_lines.fetch_and(~(uint32_t{ 1 } << source)); }
+
+void CPU::trigger_nmi() noexcept { _nmi_edge.store(true); }
+
 double CPU::frequency() const noexcept { return _frequency; }
 
+size_t CPU::cycle() const noexcept { return _cycle; }
+
+bool CPU::irq_masked() const noexcept { return _irq_masked; }
+
+uint64_t CPU::digest() const noexcept {
+    auto x = static_cast<uint64_t>(PC) | static_cast<uint64_t>(SP) << 16 | static_cast<uint64_t>(A) << 24
+           | static_cast<uint64_t>(X) << 32 | static_cast<uint64_t>(Y) << 40
+           | static_cast<uint64_t>(SR.to_byte()) << 48 | static_cast<uint64_t>(_irq_masked) << 56;
+    // The finalizer of MurmurHash3 spreads every register over the whole word before it joins the memory digest
+    x = (x ^ x >> 33) * 0xFF51AFD7ED558CCD;
+    x = (x ^ x >> 33) * 0xC4CEB9FE1A85EC53;
+    return _memory.digest() ^ (x ^ x >> 33);
+}
+
+void CPU::set_registers(const Registers &registers) noexcept {
+    Core::set_registers(registers);
+    _irq_masked = SR.interrupt;
+}
+
+void CPU::set_profiler(Profiler *const profiler) noexcept { _profiler = profiler; }
+
+void CPU::set_coverage(Coverage *const coverage) noexcept { _coverage = coverage; }
+
+void CPU::set_edge_coverage(EdgeCoverage *const edges) noexcept { _edges = edges; }
+
+void CPU::set_breakpoints(Breakpoints *const breakpoints) noexcept { _breakpoints = breakpoints; }
+
+void CPU::set_scheduler(Scheduler *const scheduler) noexcept { _scheduler = scheduler; }
+
+void CPU::set_guard(Guard *const guard) noexcept { _guard = guard; }
+
+void CPU::set_journal(Journal *const journal) noexcept { _journal = journal; }
+
+void CPU::set_write_log(WriteLog *const write_log) noexcept { _write_log = write_log; }
+
+void CPU::set_loop_acceleration(const bool enabled) noexcept { _accelerate_loops = enabled; }
+
+bool CPU::set_host_call(const uint8_t opcode, HostCall *const host_call) noexcept {
+    if (operations[opcode]) return false;
+    _host_calls[opcode] = host_call;
+    return true;
+}
+
+CPU::Snapshot CPU::snapshot() const {
+    return { .registers = registers(), .cycle = _cycle, .irq_masked = _irq_masked, .memory = _memory };
+}
+
+void CPU::restore(const Snapshot &snapshot) {
+    set_registers(snapshot.registers);
+    _cycle      = snapshot.cycle;
+    _irq_masked = snapshot.irq_masked;
+    _memory     = snapshot.memory;
+}
+
 const Memory &CPU::memory() const & noexcept { return _memory; }
 
+Memory &CPU::memory() & noexcept { return _memory; }
+
 Memory &&CPU::memory() && noexcept { return std::move(_memory); }
 
-uint16_t CPU::make_word(const uint8_t high, const uint8_t low) noexcept {
-    return static_cast<uint16_t>(high) << 8 | static_cast<uint16_t>(low);
+void CPU::reset() noexcept {
+    Core::reset();
+    _irq_masked = true;
 }
 
-void CPU::reset() noexcept {
-    read(PC++);
-    read(PC++);
-    read(0x0100 + SP);
-    read(0x0100 + SP - 1);
-    read(0x0100 + SP - 2);
-    const auto pcl = read(RES);
-    const auto pch = read(RES + 1);
-    PC             = make_word(pch, pcl);
+bool CPU::step() noexcept { return step(std::numeric_limits<size_t>::max()); }
+
+bool CPU::step(const size_t end) noexcept {
+    const auto pc    = PC;
+    const auto sp    = SP;
+    const auto start = _cycle;
+
+    if (_breakpoints) _breakpoints->clear_hit(); // the interrupt sequence is watched as well
+    if (_journal) _journal->boundary(*this);
+    if (_scheduler && _cycle >= _scheduler->deadline()) _scheduler->dispatch(_cycle);
+
+    if (poll_interrupts()) {
+        if (_edges) _edges->mark(pc, PC);
+        if (_profiler) _profiler->record_interrupt(sp, _cycle - start, PC);
+        return (!_breakpoints || !_breakpoints->hit()) && (!_guard || !_guard->violation());
+    }
+
+    if (_breakpoints && _breakpoints->before_instruction(PC, _memory[PC])) return false;
+    if (_accelerate_loops && accelerate_loop(end)) return true;
+
+    const auto opcode = fetch();
+
+    if (_guard && _guard->violation()) [[unlikely]] {
+        --PC; // stay at the instruction that may not be executed
+        return false;
+    }
+
+    const auto &operation = operations[opcode];
+    if (!operation) {
+        // The routine accesses the memory directly, so anything that has to see its writes would miss them
+        const bool observed = _coverage || _guard || _write_log || (_breakpoints && _breakpoints->watches_memory())
+                           || (_scheduler && _scheduler->mapped());
+        if (auto *const host_call = _host_calls[opcode]; host_call && !observed) {
+            auto registers    = this->registers();
+            const auto cycles = host_call->call(registers, _memory);
+            Core::set_registers(registers);
+            _irq_masked = SR.interrupt;
+            for (size_t i = 0; i < cycles; ++i)
+                while (!_clock.value()) {} // every cycle of the routine takes a clock pulse
+            _cycle += cycles;
+
+            if (_edges) _edges->mark(pc, PC);
+            if (_profiler) _profiler->record(pc, opcode, sp, _cycle - start, PC, SP);
+            return !_breakpoints || !_breakpoints->hit();
+        }
+        --PC; // jam at the illegal opcode, or at the trap that may not be taken
+        return false;
+    }
+
+    // The interrupts are polled before the last cycle of an instruction,
+    // which is too early to see the new value of the flag set by these instructions
+    const auto instruction = operation->instruction;
+    const bool delayed_mask = instruction == Instruction::CLI || instruction == Instruction::SEI
+                           || instruction == Instruction::PLP;
+    const bool masked = SR.interrupt;
+
+    execute(instruction, operation->addressing);
+    _irq_masked = delayed_mask ? masked : SR.interrupt;
+
+    if (_edges && transfers_control(instruction)) _edges->mark(pc, PC);
+    if (_profiler) _profiler->record(pc, opcode, sp, _cycle - start, PC, SP);
+    return (!_breakpoints || !_breakpoints->hit()) && (!_guard || !_guard->violation());
 }
 
-uint8_t CPU::read(const uint16_t address) noexcept {
+bool CPU::accelerate_loop(const size_t limit) noexcept {
+    // The instructions of the loop are LDA (src),Y for a copy, then STA (dst),Y; INY; BNE loop
+    const auto at      = [this](const unsigned address) { return _memory[static_cast<uint16_t>(address)]; };
+    const bool copy    = at(PC) == 0xB1;
+    const auto store   = static_cast<uint16_t>(copy ? PC + 2 : PC);
+    const auto end     = static_cast<uint16_t>(store + 5);
+    const uint8_t back = copy ? 0xF9 : 0xFB;
+    if (at(store) != 0x91 || at(store + 2u) != 0xC8 || at(store + 3u) != 0xD0 || at(store + 4u) != back) return false;
+
+    // The observers see every access, so they need the loop to be executed instruction by instruction
+    if (_profiler || _coverage || _edges || _breakpoints || _guard || _journal || _write_log) return false;
+
+    const auto pointer = [at](const uint8_t address) {
+        return make_word(at(static_cast<uint8_t>(address + 1)), at(address));
+    };
+    const uint8_t source_pointer      = at(PC + 1u);
+    const uint8_t destination_pointer = at(store + 1u);
+    const auto source                 = pointer(source_pointer);
+    const auto destination            = pointer(destination_pointer);
+    const unsigned count              = 0x100 - Y;
+
+    const auto overwrites = [destination, first = Y, count](const unsigned address) {
+        return static_cast<uint16_t>(address - destination - first) < count;
+    };
+    if (overwrites(destination_pointer) || overwrites(static_cast<uint8_t>(destination_pointer + 1))
+        || (copy && (overwrites(source_pointer) || overwrites(static_cast<uint8_t>(source_pointer + 1)))))
+        return false;
+    for (unsigned address = PC; address != end; address = static_cast<uint16_t>(address + 1))
+        if (overwrites(address)) return false;
+
+    // The branch back and the loads crossing a page take a cycle more
+    const size_t branch = (PC & 0xFF00) != (end & 0xFF00) ? 4 : 3;
+    size_t cycles       = 0;
+    for (unsigned y = Y; y < 0x100; ++y) {
+        if (copy) cycles += (source & 0x00FF) + y > 0xFF ? 6 : 5;
+        cycles += 6 + 2 + (y == 0xFF ? 2 : branch);
+    }
+    if (_cycle + cycles > limit) return false;
+
+    if (_scheduler) {
+        if (_cycle + cycles > _scheduler->deadline()) return false;
+        const auto mapped = [this](const unsigned address) {
+            return _scheduler->device(static_cast<uint16_t>(address)) != nullptr;
+        };
+        if (mapped(PC) || mapped(end) || mapped(0) || mapped(destination) || mapped(destination + 0xFFu)
+            || (copy && (mapped(source) || mapped(source + 0xFFu))))
+            return false;
+    }
+
+    // The copy goes forward byte by byte, so an overlapping destination repeats the source as the loop would
+    for (unsigned y = Y; y < 0x100; ++y) {
+        if (copy) A = _memory[static_cast<uint16_t>(source + y)];
+        _memory.write(static_cast<uint16_t>(destination + y), A);
+    }
+    Y           = 0;
+    SR.negative = false;
+    SR.zero     = true;
+    PC          = end;
+    _irq_masked = SR.interrupt;
+
+    for (size_t i = 0; i < cycles; ++i)
+        while (!_clock.value()) {} // every cycle of the loop takes a clock pulse
+    _cycle += cycles;
+    return true;
+}
+
+bool CPU::poll_interrupts() noexcept {
+    std::optional<uint16_t> vector;
+    if (_journal && _journal->mode() == Journal::Mode::Replay) vector = _journal->replay_interrupt(_cycle);
+    // Plain loads are enough to detect the rare requests, the acquiring operations are only performed on them
+    else if (_nmi_edge.load(std::memory_order_relaxed) && _nmi_edge.exchange(false, std::memory_order_acquire))
+        vector = NMI;
+    else if (!_irq_masked && _irq_lines.load(std::memory_order_acquire) != 0) vector = IRQ;
+
+    if (!vector) return false;
+    if (_journal && _journal->mode() == Journal::Mode::Record) _journal->record_interrupt(_cycle, *vector);
+
+    read(PC);
+    read(PC);
+    interrupt(*vector, false);
+    _irq_masked = true;
+    return true;
+}
+
+uint8_t CPU::bus_read(const uint16_t address) noexcept {
     while (!_clock.value()) {} // wait for the next clock pulse
     _cycle++;
-    return _memory[address];
+    if (_coverage) _coverage->mark(Access::Read, address);
+    if (_guard && !_guard->permits(Access::Read, address)) [[unlikely]]
+        return 0;
+    const auto value = _scheduler ? read_device(address) : _memory[address];
+    if (_breakpoints) _breakpoints->check(Access::Read, address, value);
+    return value;
+}
+
+uint8_t CPU::read_device(const uint16_t address) noexcept {
+    auto *const device = _scheduler->device(address);
+    if (!device) return _memory[address];
+    if (_journal && _journal->mode() == Journal::Mode::Replay) return _journal->replay_read(_cycle, address);
+
+    device->synchronize(_cycle);
+    const auto value = device->read(address);
+    if (_journal && _journal->mode() == Journal::Mode::Record) _journal->record_read(_cycle, address, value);
+    return value;
 }
+
+uint8_t CPU::bus_fetch(const uint16_t address) noexcept {
+    while (!_clock.value()) {} // wait for the next clock pulse
+    _cycle++;
+    if (_coverage) _coverage->mark(Access::Execute, address);
+    if (_guard && !_guard->permits(Access::Execute, address)) [[unlikely]]
+        return 0;
+    return _scheduler ? read_device(address) : _memory[address];
+}
+
+void CPU::bus_write(const uint16_t address, const uint8_t value) noexcept {
+    while (!_clock.value()) {} // wait for the next clock pulse
+    _cycle++;
+    if (_coverage) _coverage->mark(Access::Write, address);
+    if (_breakpoints) _breakpoints->check(Access::Write, address, value);
+    if (_guard && !_guard->permits(Access::Write, address)) [[unlikely]]
+        return;
+    if (_write_log) _write_log->record(_cycle, address, value);
+    if (auto *const device = _scheduler ? _scheduler->device(address) : nullptr) {
+        device->synchronize(_cycle);
+        device->write(address, value);
+    } else _memory.write(address, value);
+}
+
 } // namespace emulator::mos_6502
\ No newline at end of file
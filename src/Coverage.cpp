@@ -0,0 +1,81 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Coverage.hpp"
+
+#include <bit>
+
+namespace emulator::mos_6502 {
+bool Coverage::test(const Access access, const uint16_t address) const noexcept {
+    return (_bitmaps[static_cast<size_t>(access)][address >> 6] >> (address & 63) & 1) != 0;
+}
+
+size_t Coverage::count(const Access access) const noexcept {
+    size_t result = 0;
+    for (const auto word : _bitmaps[static_cast<size_t>(access)]) result += static_cast<size_t>(std::popcount(word));
+    return result;
+}
+
+void Coverage::clear() noexcept {
+    for (auto &bitmap : _bitmaps) bitmap.fill(0);
+}
+
+Coverage &Coverage::operator|=(const Coverage &other) noexcept {
+    // A flat loop over the words without dependencies is vectorized into wide ORs
+    for (size_t i = 0; i < _bitmaps.size(); ++i)
+        for (size_t j = 0; j < _bitmaps[i].size(); ++j) _bitmaps[i][j] |= other._bitmaps[i][j];
+    return *this;
+}
+
+void Coverage::write_json(std::ostream &stream) const {
+    static constexpr std::array<const char *, 3> names{ "execute", "read", "write" };
+
+    stream << '{';
+    for (size_t kind = 0; kind < _bitmaps.size(); ++kind) {
+        if (kind > 0) stream << ", ";
+        stream << '"' << names[kind] << "\": [";
+
+        bool first = true;
+        for (size_t address = 0; address < 0x10000;) {
+            if (!test(static_cast<Access>(kind), static_cast<uint16_t>(address))) {
+                ++address;
+                continue;
+            }
+
+            const auto begin = address;
+            while (address < 0x10000 && test(static_cast<Access>(kind), static_cast<uint16_t>(address))) ++address;
+            stream << (first ? "" : ", ") << '[' << begin << ", " << address - 1 << ']';
+            first = false;
+        }
+        stream << ']';
+    }
+    stream << "}\n";
+}
+
+void Coverage::write_image(std::ostream &stream) const {
+    stream << "P6\n256 256\n255\n";
+    for (size_t address = 0; address < 0x10000; ++address) {
+        const auto value = [this, address](const Access access) {
+            return test(access, static_cast<uint16_t>(address)) ? '\xFF' : '\0';
+        };
+        const char pixel[] = { value(Access::Execute), value(Access::Read), value(Access::Write) };
+        stream.write(pixel, sizeof(pixel));
+    }
+}
+
+size_t EdgeCoverage::count() const noexcept {
+    size_t result = 0;
+    for (const auto word : _bitmap) result += static_cast<size_t>(std::popcount(word));
+    return result;
+}
+
+void EdgeCoverage::clear() noexcept { _bitmap.fill(0); }
+
+const EdgeCoverage::Bitmap &EdgeCoverage::bitmap() const noexcept { return _bitmap; }
+
+EdgeCoverage &EdgeCoverage::operator|=(const EdgeCoverage &other) noexcept {
+    for (size_t i = 0; i < _bitmap.size(); ++i) _bitmap[i] |= other._bitmap[i];
+    return *this;
+}
+} // namespace emulator::mos_6502
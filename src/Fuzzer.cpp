@@ -0,0 +1,181 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Fuzzer.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace emulator::mos_6502 {
+namespace {
+/// @brief Values at the boundaries of the signed and unsigned ranges, which often take the rare paths
+constexpr std::array<uint8_t, 6> interesting{ 0x00, 0x01, 0x7F, 0x80, 0xFE, 0xFF };
+} // namespace
+
+Fuzzer::Fuzzer(const Memory &image, Options options) : _image(image), _options(std::move(options)) {
+    if (_options.threads == 0) _options.threads = std::max(std::thread::hardware_concurrency(), 1u);
+    _options.sync = std::max<size_t>(_options.sync, 1);
+}
+
+void Fuzzer::add_seed(const std::span<const uint8_t> input) {
+    const auto length = std::min(input.size(), _options.max_length);
+    _corpus.emplace_back(input.begin(), input.begin() + static_cast<ptrdiff_t>(length));
+}
+
+Fuzzer::Report Fuzzer::run(const size_t executions) {
+    std::vector<std::unique_ptr<Worker>> workers;
+    for (unsigned i = 0; i < _options.threads; ++i) {
+        const auto seed = _options.seed + _runs * _options.threads + i;
+        workers.push_back(
+                std::make_unique<Worker>(Worker{ .sandbox = Sandbox(_image), .random = std::mt19937_64(seed) }));
+        workers.back()->sandbox.set_edge_coverage(&workers.back()->edges);
+    }
+    ++_runs;
+
+    // The seeds are executed first, so that only the inputs reaching beyond them are added
+    auto remaining = executions;
+    if (_executions == 0) {
+        if (_corpus.empty()) _corpus.emplace_back();
+        for (const auto &seed : _corpus) {
+            if (remaining == 0) break;
+            static_cast<void>(execute(*workers.front(), seed));
+            --remaining;
+        }
+    }
+    for (auto &worker : workers) {
+        worker->corpus = _corpus;
+        worker->cursor = _corpus.size();
+    }
+
+    _remaining = remaining;
+    {
+        std::vector<std::jthread> threads;
+        for (size_t i = 1; i < workers.size(); ++i)
+            threads.emplace_back([this, &worker = *workers[i]] { work(worker); });
+        work(*workers.front());
+    }
+    if (_failure) std::rethrow_exception(std::exchange(_failure, nullptr));
+    _executions += executions;
+
+    size_t edges = 0;
+    for (const auto &word : _edges) edges += static_cast<size_t>(std::popcount(word.load()));
+    return { .executions = _executions, .corpus = _corpus.size(), .edges = edges, .findings = _findings };
+}
+
+const std::vector<std::vector<uint8_t>> &Fuzzer::corpus() const noexcept { return _corpus; }
+
+void Fuzzer::work(Worker &worker) noexcept {
+    try {
+        size_t since = 0;
+        for (auto left = _remaining.load(std::memory_order_relaxed); left != 0;) {
+            if (!_remaining.compare_exchange_weak(left, left - 1, std::memory_order_relaxed)) continue;
+
+            auto input = mutate(worker);
+            if (execute(worker, input)) {
+                worker.corpus.push_back(input);
+                worker.discovered.push_back(std::move(input));
+            }
+            if (++since == _options.sync) {
+                since = 0;
+                synchronize(worker);
+            }
+            left = _remaining.load(std::memory_order_relaxed);
+        }
+        synchronize(worker);
+    } catch (...) {
+        const std::scoped_lock lock(_mutex);
+        if (!_failure) _failure = std::current_exception();
+        _remaining = 0; // the other workers stop after their current execution
+    }
+}
+
+std::vector<uint8_t> Fuzzer::mutate(Worker &worker) const {
+    auto &random = worker.random;
+    auto input   = worker.corpus[random() % worker.corpus.size()];
+
+    // A few mutations are stacked, so that a single execution may change several distant bytes
+    for (auto count = 1 + random() % 4; count != 0; --count) {
+        const auto position = input.empty() ? 0 : random() % input.size();
+        switch (random() % 8) {
+        case 0:
+            if (!input.empty()) input[position] ^= static_cast<uint8_t>(1 << random() % 8);
+            break;
+        case 1:
+            if (!input.empty()) input[position] = static_cast<uint8_t>(random());
+            break;
+        case 2:
+            if (!input.empty()) input[position] = interesting[random() % interesting.size()];
+            break;
+        case 3:
+            if (!input.empty()) input[position] += static_cast<uint8_t>(random() % 33 - 16);
+            break;
+        case 4:
+            if (input.size() < _options.max_length)
+                input.insert(input.begin() + static_cast<ptrdiff_t>(position), static_cast<uint8_t>(random()));
+            break;
+        case 5:
+            if (!input.empty()) input.erase(input.begin() + static_cast<ptrdiff_t>(position));
+            break;
+        case 6: {
+            // Splice a part of another input over this one
+            const auto &other = worker.corpus[random() % worker.corpus.size()];
+            if (other.empty()) break;
+            const auto from   = random() % other.size();
+            const auto length = std::min<size_t>(1 + random() % (other.size() - from), _options.max_length - position);
+            if (input.size() < position + length) input.resize(position + length);
+            std::copy_n(other.begin() + static_cast<ptrdiff_t>(from), length,
+                        input.begin() + static_cast<ptrdiff_t>(position));
+            break;
+        }
+        default:
+            if (input.size() < _options.max_length) input.push_back(static_cast<uint8_t>(random()));
+            break;
+        }
+    }
+    return input;
+}
+
+bool Fuzzer::execute(Worker &worker, const std::vector<uint8_t> &input) {
+    auto &sandbox = worker.sandbox;
+    sandbox.reset();
+    sandbox.load(_options.buffer, input);
+    const std::array length{ static_cast<uint8_t>(input.size()), static_cast<uint8_t>(input.size() >> 8) };
+    sandbox.load(_options.length, length);
+    worker.edges.clear();
+    const auto outcome = sandbox.call(_options.entry, _options.limits);
+
+    // Most of the words are empty or known, only the new bits need the atomic operation
+    bool discovered    = false;
+    const auto &bitmap = worker.edges.bitmap();
+    for (size_t i = 0; i < bitmap.size(); ++i) {
+        const auto word = bitmap[i];
+        if (word == 0 || (word & ~_edges[i].load(std::memory_order_relaxed)) == 0) continue;
+        if ((_edges[i].fetch_or(word, std::memory_order_relaxed) & word) != word) discovered = true;
+    }
+
+    if (outcome.termination == Sandbox::Termination::Returned) return discovered;
+
+    // A hang stops anywhere in its loop, so only those reaching new edges are distinct
+    const bool hang = outcome.termination == Sandbox::Termination::CycleBudget;
+    const std::scoped_lock lock(_mutex);
+    const bool known = std::ranges::any_of(_findings, [&](const Finding &finding) {
+        return finding.termination == outcome.termination && (hang || finding.address == outcome.registers.PC);
+    });
+    if (!known || (hang && discovered))
+        _findings.push_back({ .termination = outcome.termination, .address = outcome.registers.PC, .input = input });
+    return discovered;
+}
+
+void Fuzzer::synchronize(Worker &worker) {
+    const std::scoped_lock lock(_mutex);
+    worker.corpus.insert(worker.corpus.end(), _corpus.begin() + static_cast<ptrdiff_t>(worker.cursor), _corpus.end());
+    _corpus.insert(_corpus.end(), std::make_move_iterator(worker.discovered.begin()),
+                   std::make_move_iterator(worker.discovered.end()));
+    worker.discovered.clear();
+    worker.cursor = _corpus.size();
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,46 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Guard.hpp"
+
+#include <algorithm>
+
+namespace emulator::mos_6502 {
+Guard::Guard() noexcept { _pages.fill(0b111); }
+
+void Guard::permit(const uint8_t first_page, const uint8_t last_page,
+                   const std::initializer_list<Access> accesses) noexcept {
+    uint8_t bits = 0;
+    for (const auto access : accesses) bits |= static_cast<uint8_t>(1 << static_cast<unsigned>(access));
+    std::fill(_pages.begin() + first_page, _pages.begin() + last_page + 1, bits);
+}
+
+void Guard::set_write_budget(const size_t writes) noexcept { _write_budget = writes; }
+
+void Guard::clear() noexcept {
+    _writes = 0;
+    _violation.reset();
+}
+
+const std::optional<Guard::Violation> &Guard::violation() const noexcept { return _violation; }
+
+size_t Guard::writes() const noexcept { return _writes; }
+
+bool Guard::count(const Access access, const uint16_t address, const bool permitted) noexcept {
+    if (_violation) return false;
+
+    if (!permitted) {
+        _violation = Violation{ .kind = Violation::Kind::Permission, .access = access, .address = address };
+        return false;
+    }
+
+    if (_writes >= _write_budget) {
+        _violation = Violation{ .kind = Violation::Kind::WriteBudget, .access = access, .address = address };
+        return false;
+    }
+
+    ++_writes;
+    return true;
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,269 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Journal.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <new>
+
+namespace emulator::mos_6502 {
+namespace {
+/**
+ * @brief Append an unsigned integer in LEB128: seven bits per byte, the highest bit marks a continuation
+ */
+void encode(std::vector<uint8_t> &stream, size_t value) {
+    while (value >= 0x80) {
+        stream.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    stream.push_back(static_cast<uint8_t>(value));
+}
+
+/**
+ * @brief Read an unsigned integer in LEB128
+ *
+ * @retval std::nullopt If the stream ends before the integer does
+ */
+std::optional<size_t> decode_integer(const std::vector<uint8_t> &stream, size_t &position) noexcept {
+    size_t value = 0;
+    for (unsigned shift = 0; position < stream.size() && shift < 64; shift += 7) {
+        const auto byte = stream[position++];
+        value |= static_cast<size_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return value;
+    }
+    return std::nullopt;
+}
+
+/// @brief Whether the events of a kind carry an address and a value
+bool has_payload(const Journal::Event::Kind kind) noexcept {
+    return kind == Journal::Event::Kind::DeviceRead || kind == Journal::Event::Kind::Input;
+}
+} // namespace
+
+Journal::Journal(const size_t snapshot_interval) noexcept : _interval(snapshot_interval) {}
+
+void Journal::record(const CPU &cpu) {
+    _stream.clear();
+    _checkpoints.clear();
+    // The stream starts with the cycle of the recording start, the base of the first difference
+    encode(_stream, cpu.cycle());
+    _previous = cpu.cycle();
+    _checkpoints.push_back({ .snapshot = cpu.snapshot(), .position = _stream.size(), .previous = _previous });
+    _mode       = Mode::Record;
+    _diverged   = false;
+    _overflowed = false;
+}
+
+void Journal::replay(CPU &cpu) {
+    if (_checkpoints.empty()) {
+        size_t position   = 0;
+        const auto origin = decode_integer(_stream, position);
+        _checkpoints.push_back({ .snapshot = cpu.snapshot(), .position = position, .previous = origin.value_or(0) });
+    }
+
+    const auto &start = _checkpoints.front();
+    cpu.restore(start.snapshot);
+    _position = start.position;
+    _previous = start.previous;
+    _decoded  = false;
+    _mode     = Mode::Replay;
+    _diverged = false;
+}
+
+bool Journal::seek(CPU &cpu, const size_t cycle) {
+    if (_mode != Mode::Replay || _checkpoints.empty()) replay(cpu);
+
+    // The last snapshot taken at or before the cycle
+    const auto after = std::ranges::upper_bound(_checkpoints, cycle, {}, [](const Checkpoint &checkpoint) {
+        return checkpoint.snapshot.cycle;
+    });
+    const auto &closest = after == _checkpoints.begin() ? _checkpoints.front() : *std::prev(after);
+    if (cpu.cycle() > cycle || cpu.cycle() < closest.snapshot.cycle) {
+        cpu.restore(closest.snapshot);
+        _position = closest.position;
+        _previous = closest.previous;
+        _decoded  = false;
+    }
+
+    while (cpu.cycle() < cycle)
+        if (!cpu.step()) return false;
+    return true;
+}
+
+bool Journal::resume() noexcept {
+    if (_mode != Mode::Replay || _position != _stream.size()) return false;
+    _mode = Mode::Record;
+    return true;
+}
+
+size_t Journal::closest(const size_t cycle) const noexcept {
+    if (_checkpoints.empty()) return 0;
+    const auto after = std::ranges::upper_bound(_checkpoints, cycle, {}, [](const Checkpoint &checkpoint) {
+        return checkpoint.snapshot.cycle;
+    });
+    return (after == _checkpoints.begin() ? _checkpoints.front() : *std::prev(after)).snapshot.cycle;
+}
+
+void Journal::input(CPU &cpu, const uint16_t address, const uint8_t value) {
+    if (_mode == Mode::Replay) return;
+
+    cpu.memory().write(address, value);
+    if (_mode == Mode::Record)
+        append({ .kind = Event::Kind::Input, .cycle = cpu.cycle(), .address = address, .value = value });
+}
+
+void Journal::stop() noexcept { _mode = Mode::Idle; }
+
+bool Journal::diverged() const noexcept { return _diverged; }
+
+bool Journal::overflowed() const noexcept { return _overflowed; }
+
+std::vector<Journal::Event> Journal::events() const {
+    std::vector<Event> result;
+    size_t position = 0;
+    auto previous   = decode_integer(_stream, position).value_or(0);
+    while (const auto event = decode(position, previous)) result.push_back(*event);
+    return result;
+}
+
+const std::vector<uint8_t> &Journal::stream() const noexcept { return _stream; }
+
+size_t Journal::snapshots() const noexcept { return _checkpoints.size(); }
+
+void Journal::save(std::ostream &output) const {
+    output.write(reinterpret_cast<const char *>(_stream.data()), static_cast<std::streamsize>(_stream.size()));
+}
+
+bool Journal::load(std::istream &input) {
+    std::vector<uint8_t> stream(std::istreambuf_iterator<char>(input), {});
+
+    // Every event must be complete
+    size_t position = 0;
+    auto previous   = decode_integer(stream, position);
+    if (!previous) return false;
+    std::swap(_stream, stream);
+    while (decode(position, *previous)) {}
+    if (position != _stream.size()) {
+        std::swap(_stream, stream);
+        return false;
+    }
+
+    _checkpoints.clear();
+    _mode = Mode::Idle;
+    return true;
+}
+
+void Journal::boundary(CPU &cpu) noexcept {
+    if (_mode == Mode::Replay) {
+        while (const auto &next = peek()) {
+            if (next->kind != Event::Kind::Input || next->cycle > cpu.cycle()) break;
+            if (next->cycle < cpu.cycle()) _diverged = true; // applied late, but still applied
+            cpu.memory().write(next->address, next->value);
+            consume();
+        }
+    }
+
+    if (_mode != Mode::Idle) checkpoint(cpu);
+}
+
+void Journal::record_read(const size_t cycle, const uint16_t address, const uint8_t value) noexcept {
+    append({ .kind = Event::Kind::DeviceRead, .cycle = cycle, .address = address, .value = value });
+}
+
+uint8_t Journal::replay_read(const size_t cycle, const uint16_t address) noexcept {
+    const auto &next = peek();
+    if (!next || next->kind != Event::Kind::DeviceRead || next->cycle != cycle || next->address != address) {
+        _diverged = true;
+        return 0;
+    }
+
+    const auto value = next->value;
+    consume();
+    return value;
+}
+
+void Journal::record_interrupt(const size_t cycle, const uint16_t vector) noexcept {
+    append({ .kind = vector == CPU::NMI ? Event::Kind::NonMaskable : Event::Kind::Interrupt, .cycle = cycle });
+}
+
+std::optional<uint16_t> Journal::replay_interrupt(const size_t cycle) noexcept {
+    const auto &next = peek();
+    if (!next || (next->kind != Event::Kind::Interrupt && next->kind != Event::Kind::NonMaskable)) return std::nullopt;
+    if (next->cycle > cycle) return std::nullopt;
+    if (next->cycle < cycle) _diverged = true;
+
+    const auto vector = next->kind == Event::Kind::NonMaskable ? CPU::NMI : CPU::IRQ;
+    consume();
+    return vector;
+}
+
+void Journal::append(const Event &event) noexcept {
+    const auto size = _stream.size();
+    try {
+        _stream.push_back(static_cast<uint8_t>(event.kind));
+        encode(_stream, event.cycle - _previous);
+        if (has_payload(event.kind)) {
+            _stream.push_back(static_cast<uint8_t>(event.address));
+            _stream.push_back(static_cast<uint8_t>(event.address >> 8));
+            _stream.push_back(event.value);
+        }
+    } catch (const std::bad_alloc &) {
+        _stream.resize(size); // drop the incomplete event
+        _mode       = Mode::Idle;
+        _overflowed = true;
+        return;
+    }
+    _previous = event.cycle;
+}
+
+std::optional<Journal::Event> Journal::decode(size_t &position, size_t &previous) const noexcept {
+    if (position >= _stream.size() || _stream[position] > static_cast<uint8_t>(Event::Kind::Input))
+        return std::nullopt;
+
+    auto cursor          = position;
+    const auto kind      = static_cast<Event::Kind>(_stream[cursor++]);
+    const auto increment = decode_integer(_stream, cursor);
+    if (!increment) return std::nullopt;
+
+    Event event{ .kind = kind, .cycle = previous + *increment };
+    if (has_payload(kind)) {
+        if (cursor + 3 > _stream.size()) return std::nullopt;
+        event.address = static_cast<uint16_t>(_stream[cursor] | _stream[cursor + 1] << 8);
+        event.value   = _stream[cursor + 2];
+        cursor += 3;
+    }
+
+    position = cursor;
+    previous = event.cycle;
+    return event;
+}
+
+const std::optional<Journal::Event> &Journal::peek() noexcept {
+    if (!_decoded) {
+        auto position = _position;
+        auto previous = _previous;
+        _next         = decode(position, previous);
+        _decoded      = true;
+    }
+    return _next;
+}
+
+void Journal::consume() noexcept {
+    // Decoding again is cheap, and keeps the position at the start of the next event for the snapshots
+    static_cast<void>(decode(_position, _previous));
+    _decoded = false;
+}
+
+void Journal::checkpoint(const CPU &cpu) noexcept {
+    if (_interval == 0 || cpu.cycle() < _checkpoints.back().snapshot.cycle + _interval) return;
+
+    const auto position = _mode == Mode::Record ? _stream.size() : _position;
+    try {
+        _checkpoints.push_back({ .snapshot = cpu.snapshot(), .position = position, .previous = _previous });
+    } catch (const std::bad_alloc &) {
+        // Seeking starts from an earlier snapshot instead
+    }
+}
+} // namespace emulator::mos_6502
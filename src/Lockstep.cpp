@@ -0,0 +1,572 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "ALU.hpp"
+#include "Lockstep.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace emulator::mos_6502 {
+namespace {
+/// @name Bits of the status register
+/// @{
+constexpr uint8_t N = 0x80;
+constexpr uint8_t V = 0x40;
+constexpr uint8_t D = 0x08;
+constexpr uint8_t I = 0x04;
+constexpr uint8_t Z = 0x02;
+constexpr uint8_t C = 0x01;
+/// @}
+
+struct Operation {
+    Instruction instruction;
+    Addressing addressing;
+};
+
+/**
+ * @brief Decoding table for all the opcodes
+ */
+const std::array<std::optional<Operation>, 256> operations = [] {
+    std::array<std::optional<Operation>, 256> result{};
+    for (size_t opcode = 0; opcode < result.size(); ++opcode) {
+        const auto instruction = getInstruction(static_cast<uint8_t>(opcode));
+        const auto addressing  = getAddressing(static_cast<uint8_t>(opcode));
+        if (instruction && addressing) result[opcode] = Operation{ *instruction, *addressing };
+    }
+    return result;
+}();
+
+[[nodiscard]] constexpr uint16_t make_word(const uint8_t high, const uint8_t low) noexcept {
+    return static_cast<uint16_t>(high << 8 | low);
+}
+
+/**
+ * @brief Take the first value in the lanes where the mask is 0xFF, and the second one where it is zero
+ */
+[[nodiscard]] constexpr uint8_t blend(const uint8_t mask, const uint8_t first, const uint8_t second) noexcept {
+    return static_cast<uint8_t>((first & mask) | (second & ~mask));
+}
+
+/**
+ * @brief Status with the negative and zero flags set after a value
+ */
+[[nodiscard]] constexpr uint8_t with_nz(const uint8_t status, const uint8_t value) noexcept {
+    return static_cast<uint8_t>((status & ~(N | Z)) | (value & N) | (value == 0 ? Z : 0));
+}
+
+/// @name Branch-free counterparts of @link ALU @endlink working on a status byte
+/// @{
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> adc(const uint8_t a,
+                                                        const uint8_t b,
+                                                        const uint8_t status) noexcept {
+    const auto sum    = static_cast<uint16_t>(a + b + (status & C));
+    const auto result = static_cast<uint8_t>(sum);
+    const auto flags  = (status & ~(V | C)) | (~(a ^ b) & (a ^ result) & N) >> 1 | sum >> 8;
+    return { result, with_nz(static_cast<uint8_t>(flags), result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> sbc(const uint8_t a,
+                                                        const uint8_t b,
+                                                        const uint8_t status) noexcept {
+    const auto difference = static_cast<int16_t>(a - b - (~status & C));
+    const auto result     = static_cast<uint8_t>(difference);
+    const auto flags      = (status & ~(V | C)) | ((a ^ b) & (a ^ result) & N) >> 1 | (difference >= 0 ? C : 0);
+    return { result, with_nz(static_cast<uint8_t>(flags), result) };
+}
+
+[[nodiscard]] constexpr uint8_t compare(const uint8_t a, const uint8_t b, const uint8_t status) noexcept {
+    const auto flags = (status & ~C) | (a >= b ? C : 0);
+    return with_nz(static_cast<uint8_t>(flags), static_cast<uint8_t>(a - b));
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> shift_left(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a << 1);
+    return { result, with_nz(static_cast<uint8_t>((status & ~C) | a >> 7), result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> shift_right(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a >> 1);
+    return { result, with_nz(static_cast<uint8_t>((status & ~C) | (a & C)), result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> rotate_left(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a << 1 | (status & C));
+    return { result, with_nz(static_cast<uint8_t>((status & ~C) | a >> 7), result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> rotate_right(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a >> 1 | (status & C) << 7);
+    return { result, with_nz(static_cast<uint8_t>((status & ~C) | (a & C)), result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> increment(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a + 1);
+    return { result, with_nz(status, result) };
+}
+
+[[nodiscard]] constexpr std::pair<uint8_t, uint8_t> decrement(const uint8_t a, const uint8_t status) noexcept {
+    const auto result = static_cast<uint8_t>(a - 1);
+    return { result, with_nz(status, result) };
+}
+/// @}
+} // namespace
+
+Lockstep::Lockstep(std::vector<Memory> memories) noexcept : _memories(std::move(memories)) {
+    assert(_memories.size() <= max_lanes);
+    _end.fill(std::numeric_limits<size_t>::max());
+
+    // The same sequence as CPU::reset, the three fake pushes only decrement the stack pointer
+    for (size_t lane = 0; lane < _memories.size(); ++lane) {
+        _sp[lane]    = 0xFD;
+        _p[lane]     = I;
+        _pc[lane]    = make_word(_memories[lane][CPU::RES + 1], _memories[lane][CPU::RES]);
+        _cycle[lane] = 7;
+    }
+}
+
+bool Lockstep::step() noexcept {
+    // The group with the lowest program counter goes first, so that the lanes reconverge after the loops
+    Mask active = 0;
+    uint16_t pc = std::numeric_limits<uint16_t>::max();
+    for (size_t lane = 0; lane < _memories.size(); ++lane) {
+        if ((_jammed >> lane & 1) != 0 || _cycle[lane] >= _end[lane]) continue;
+        active |= Mask{ 1 } << lane;
+        pc      = std::min(pc, _pc[lane]);
+    }
+    if (active == 0) return false;
+
+    // The memories may differ, so the lanes at the same address might still hold different opcodes
+    Mask group = 0;
+    std::optional<uint8_t> opcode;
+    for (auto lanes = active; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        if (_pc[lane] != pc) continue;
+        if (!opcode) opcode = _memories[lane][pc];
+        if (_memories[lane][pc] == *opcode) group |= Mask{ 1 } << lane;
+    }
+
+    ++_dispatches;
+    _instructions += static_cast<size_t>(std::popcount(group));
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) fetch(static_cast<size_t>(std::countr_zero(lanes)));
+
+    const auto &operation = operations[*opcode];
+    if (!operation) {
+        // Jam at the illegal opcode
+        for (auto lanes = group; lanes != 0; lanes &= lanes - 1) --_pc[static_cast<size_t>(std::countr_zero(lanes))];
+        _jammed |= group;
+        return true;
+    }
+
+    select(group);
+    execute(group, operation->instruction, operation->addressing);
+    return true;
+}
+
+void Lockstep::run(const size_t cycles) noexcept {
+    for (size_t lane = 0; lane < _memories.size(); ++lane) _end[lane] = _cycle[lane] + cycles;
+    while (step()) {}
+    _end.fill(std::numeric_limits<size_t>::max());
+}
+
+size_t Lockstep::size() const noexcept { return _memories.size(); }
+
+CPU::Registers Lockstep::registers(const size_t lane) const noexcept {
+    return { .PC = _pc[lane],
+             .SP = _sp[lane],
+             .A  = _a[lane],
+             .X  = _x[lane],
+             .Y  = _y[lane],
+             .SR = StatusRegister::from_byte(_p[lane]) };
+}
+
+void Lockstep::set_registers(const size_t lane, const CPU::Registers &registers) noexcept {
+    _pc[lane] = registers.PC;
+    _sp[lane] = registers.SP;
+    _a[lane]  = registers.A;
+    _x[lane]  = registers.X;
+    _y[lane]  = registers.Y;
+    _p[lane]  = registers.SR.to_byte();
+}
+
+size_t Lockstep::cycle(const size_t lane) const noexcept { return _cycle[lane]; }
+
+bool Lockstep::jammed(const size_t lane) const noexcept { return (_jammed >> lane & 1) != 0; }
+
+const Memory &Lockstep::memory(const size_t lane) const noexcept { return _memories[lane]; }
+
+size_t Lockstep::dispatches() const noexcept { return _dispatches; }
+
+size_t Lockstep::instructions() const noexcept { return _instructions; }
+
+void Lockstep::select(const Mask group) noexcept {
+    for (size_t lane = 0; lane < max_lanes; ++lane) _selected[lane] = (group >> lane & 1) != 0 ? 0xFF : 0x00;
+}
+
+uint8_t Lockstep::read(const size_t lane, const uint16_t address) noexcept {
+    ++_cycle[lane];
+    return _memories[lane][address];
+}
+
+uint8_t Lockstep::fetch(const size_t lane) noexcept {
+    ++_cycle[lane];
+    return _memories[lane][_pc[lane]++];
+}
+
+void Lockstep::write(const size_t lane, const uint16_t address, const uint8_t value) noexcept {
+    ++_cycle[lane];
+    _memories[lane].write(address, value);
+}
+
+void Lockstep::push(const size_t lane, const uint8_t value) noexcept { write(lane, 0x0100 | _sp[lane]--, value); }
+
+uint8_t Lockstep::pull(const size_t lane) noexcept { return read(lane, 0x0100 | ++_sp[lane]); }
+
+uint16_t Lockstep::indexed(const size_t lane, const uint16_t base, const uint8_t index, const bool write) noexcept {
+    const auto address = static_cast<uint16_t>(base + index);
+    if (write || (address & 0xFF00) != (base & 0xFF00)) read(lane, (base & 0xFF00) | (address & 0x00FF));
+    return address;
+}
+
+uint16_t Lockstep::effective_address(const size_t lane, const Addressing addressing, const bool write) noexcept {
+    switch (addressing) {
+    case Addressing::ZeroPage: return fetch(lane);
+    case Addressing::ZeroPageX: {
+        const auto base = fetch(lane);
+        read(lane, base);
+        return static_cast<uint8_t>(base + _x[lane]);
+    }
+    case Addressing::ZeroPageY: {
+        const auto base = fetch(lane);
+        read(lane, base);
+        return static_cast<uint8_t>(base + _y[lane]);
+    }
+    case Addressing::Absolute: {
+        const auto low  = fetch(lane);
+        const auto high = fetch(lane);
+        return make_word(high, low);
+    }
+    case Addressing::AbsoluteX: {
+        const auto low  = fetch(lane);
+        const auto high = fetch(lane);
+        return indexed(lane, make_word(high, low), _x[lane], write);
+    }
+    case Addressing::AbsoluteY: {
+        const auto low  = fetch(lane);
+        const auto high = fetch(lane);
+        return indexed(lane, make_word(high, low), _y[lane], write);
+    }
+    case Addressing::IndexedIndirect: {
+        const auto base = fetch(lane);
+        read(lane, base);
+        const auto pointer = static_cast<uint8_t>(base + _x[lane]);
+        const auto low     = read(lane, pointer);
+        const auto high    = read(lane, static_cast<uint8_t>(pointer + 1));
+        return make_word(high, low);
+    }
+    case Addressing::IndirectIndexed: {
+        const auto pointer = fetch(lane);
+        const auto low     = read(lane, pointer);
+        const auto high    = read(lane, static_cast<uint8_t>(pointer + 1));
+        return indexed(lane, make_word(high, low), _y[lane], write);
+    }
+    default: std::unreachable();
+    }
+}
+
+void Lockstep::gather(const Mask group, const Addressing addressing) noexcept {
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        _operand[lane]  = addressing == Addressing::Immediate ? fetch(lane)
+                                                              : read(lane, effective_address(lane, addressing, false));
+    }
+}
+
+template <typename Operation>
+void Lockstep::apply(Lanes<uint8_t> &target, Operation operation) noexcept {
+    for (size_t lane = 0; lane < max_lanes; ++lane) {
+        const auto [result, status] = [&] {
+            if constexpr (std::is_invocable_v<Operation, uint8_t, uint8_t, uint8_t>)
+                return operation(target[lane], _p[lane], _operand[lane]);
+            else return operation(target[lane], _p[lane]);
+        }();
+        target[lane]                = blend(_selected[lane], result, target[lane]);
+        _p[lane]                    = blend(_selected[lane], status, _p[lane]);
+    }
+}
+
+void Lockstep::arithmetic(const Mask group, const bool subtract) noexcept {
+    // The decimal mode is rare and full of special cases, so it is left to the scalar ALU
+    Mask decimal = 0;
+    Lanes<uint8_t> decimal_a{};
+    Lanes<uint8_t> decimal_p{};
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        if ((_p[lane] & D) == 0) continue;
+
+        decimal        |= Mask{ 1 } << lane;
+        auto status     = StatusRegister::from_byte(_p[lane]);
+        decimal_a[lane] = subtract ? ALU::subtract(_a[lane], _operand[lane], status)
+                                   : ALU::add(_a[lane], _operand[lane], status);
+        decimal_p[lane] = status.to_byte();
+    }
+
+    if (subtract) apply(_a, [](const uint8_t a, const uint8_t status, const uint8_t b) { return sbc(a, b, status); });
+    else apply(_a, [](const uint8_t a, const uint8_t status, const uint8_t b) { return adc(a, b, status); });
+
+    for (auto lanes = decimal; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        _a[lane]        = decimal_a[lane];
+        _p[lane]        = decimal_p[lane];
+    }
+}
+
+template <typename Operation>
+void Lockstep::modify(const Mask group, const Addressing addressing, Operation operation) noexcept {
+    if (addressing == Addressing::Accumulator) {
+        for (size_t lane = 0; lane < max_lanes; ++lane) _cycle[lane] += _selected[lane] & 1; // the dummy read
+        apply(_a, operation);
+        return;
+    }
+
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        _address[lane]  = effective_address(lane, addressing, true);
+        _operand[lane]  = read(lane, _address[lane]);
+        ++_cycle[lane]; // writing the unmodified value back does not change the memory
+    }
+    apply(_operand, operation);
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+        const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+        write(lane, _address[lane], _operand[lane]);
+    }
+}
+
+void Lockstep::branch(const Mask group, const uint8_t flag, const bool set) noexcept {
+    for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+        const auto lane   = static_cast<size_t>(std::countr_zero(lanes));
+        const auto offset = static_cast<int8_t>(fetch(lane));
+        if (((_p[lane] & flag) != 0) != set) continue;
+
+        auto &pc = _pc[lane];
+        read(lane, pc);
+        const auto target = static_cast<uint16_t>(pc + offset);
+        if ((target & 0xFF00) != (pc & 0xFF00)) read(lane, (pc & 0xFF00) | (target & 0x00FF));
+        pc = target;
+    }
+}
+
+void Lockstep::interrupt(const size_t lane) noexcept {
+    push(lane, static_cast<uint8_t>(_pc[lane] >> 8));
+    push(lane, static_cast<uint8_t>(_pc[lane]));
+    push(lane, _p[lane] | 0x30);
+    _p[lane]       |= I;
+    const auto low  = read(lane, CPU::IRQ);
+    const auto high = read(lane, CPU::IRQ + 1);
+    _pc[lane]       = make_word(high, low);
+}
+
+void Lockstep::execute(const Mask group, const Instruction instruction, const Addressing addressing) noexcept {
+    const auto load = [](const uint8_t, const uint8_t status, const uint8_t value) {
+        return std::pair{ value, with_nz(status, value) };
+    };
+    const auto compare_with = [this](Lanes<uint8_t> &target) {
+        for (size_t lane = 0; lane < max_lanes; ++lane)
+            _p[lane] = blend(_selected[lane], compare(target[lane], _operand[lane], _p[lane]), _p[lane]);
+    };
+    const auto store = [this, group, addressing](const Lanes<uint8_t> &source) {
+        for (auto lanes = group; lanes != 0; lanes &= lanes - 1) {
+            const auto lane = static_cast<size_t>(std::countr_zero(lanes));
+            write(lane, effective_address(lane, addressing, true), source[lane]);
+        }
+    };
+    const auto each = [group](auto action) {
+        for (auto lanes = group; lanes != 0; lanes &= lanes - 1) action(static_cast<size_t>(std::countr_zero(lanes)));
+    };
+
+    switch (instruction) {
+    case Instruction::ADC: gather(group, addressing); arithmetic(group, false); return;
+    case Instruction::SBC: gather(group, addressing); arithmetic(group, true); return;
+    case Instruction::AND:
+        gather(group, addressing);
+        apply(_a, [](const uint8_t a, const uint8_t status, const uint8_t b) {
+            const auto result = static_cast<uint8_t>(a & b);
+            return std::pair{ result, with_nz(status, result) };
+        });
+        return;
+    case Instruction::ORA:
+        gather(group, addressing);
+        apply(_a, [](const uint8_t a, const uint8_t status, const uint8_t b) {
+            const auto result = static_cast<uint8_t>(a | b);
+            return std::pair{ result, with_nz(status, result) };
+        });
+        return;
+    case Instruction::EOR:
+        gather(group, addressing);
+        apply(_a, [](const uint8_t a, const uint8_t status, const uint8_t b) {
+            const auto result = static_cast<uint8_t>(a ^ b);
+            return std::pair{ result, with_nz(status, result) };
+        });
+        return;
+    case Instruction::CMP: gather(group, addressing); compare_with(_a); return;
+    case Instruction::CPX: gather(group, addressing); compare_with(_x); return;
+    case Instruction::CPY: gather(group, addressing); compare_with(_y); return;
+    case Instruction::BIT:
+        gather(group, addressing);
+        for (size_t lane = 0; lane < max_lanes; ++lane) {
+            const auto value  = _operand[lane];
+            const auto status = (_p[lane] & ~(N | V | Z)) | (value & (N | V)) | ((_a[lane] & value) == 0 ? Z : 0);
+            _p[lane]          = blend(_selected[lane], static_cast<uint8_t>(status), _p[lane]);
+        }
+        return;
+
+    case Instruction::LDA: gather(group, addressing); apply(_a, load); return;
+    case Instruction::LDX: gather(group, addressing); apply(_x, load); return;
+    case Instruction::LDY: gather(group, addressing); apply(_y, load); return;
+
+    case Instruction::STA: store(_a); return;
+    case Instruction::STX: store(_x); return;
+    case Instruction::STY: store(_y); return;
+
+    case Instruction::ASL: modify(group, addressing, shift_left); return;
+    case Instruction::LSR: modify(group, addressing, shift_right); return;
+    case Instruction::ROL: modify(group, addressing, rotate_left); return;
+    case Instruction::ROR: modify(group, addressing, rotate_right); return;
+    case Instruction::INC: modify(group, addressing, increment); return;
+    case Instruction::DEC: modify(group, addressing, decrement); return;
+
+    case Instruction::BCC: branch(group, C, false); return;
+    case Instruction::BCS: branch(group, C, true); return;
+    case Instruction::BNE: branch(group, Z, false); return;
+    case Instruction::BEQ: branch(group, Z, true); return;
+    case Instruction::BPL: branch(group, N, false); return;
+    case Instruction::BMI: branch(group, N, true); return;
+    case Instruction::BVC: branch(group, V, false); return;
+    case Instruction::BVS: branch(group, V, true); return;
+
+    case Instruction::JMP:
+        each([this, addressing](const size_t lane) {
+            const auto low  = fetch(lane);
+            const auto high = fetch(lane);
+            auto &pc        = _pc[lane];
+            pc              = make_word(high, low);
+            if (addressing == Addressing::Indirect) {
+                const auto target_low  = read(lane, pc);
+                const auto target_high = read(lane, (pc & 0xFF00) | ((pc + 1) & 0x00FF));
+                pc                     = make_word(target_high, target_low);
+            }
+        });
+        return;
+    case Instruction::JSR:
+        each([this](const size_t lane) {
+            const auto low = fetch(lane);
+            read(lane, 0x0100 | _sp[lane]);
+            push(lane, static_cast<uint8_t>(_pc[lane] >> 8));
+            push(lane, static_cast<uint8_t>(_pc[lane]));
+            const auto high = fetch(lane);
+            _pc[lane]       = make_word(high, low);
+        });
+        return;
+    case Instruction::RTS:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            read(lane, 0x0100 | _sp[lane]);
+            const auto low  = pull(lane);
+            const auto high = pull(lane);
+            _pc[lane]       = make_word(high, low);
+            read(lane, _pc[lane]++);
+        });
+        return;
+    case Instruction::RTI:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            read(lane, 0x0100 | _sp[lane]);
+            _p[lane]        = pull(lane) & ~0x30;
+            const auto low  = pull(lane);
+            const auto high = pull(lane);
+            _pc[lane]       = make_word(high, low);
+        });
+        return;
+    case Instruction::BRK:
+        each([this](const size_t lane) {
+            fetch(lane); // the padding byte is skipped
+            interrupt(lane);
+        });
+        return;
+
+    case Instruction::PHA:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            push(lane, _a[lane]);
+        });
+        return;
+    case Instruction::PHP:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            push(lane, _p[lane] | 0x30);
+        });
+        return;
+    case Instruction::PLA:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            read(lane, 0x0100 | _sp[lane]);
+            _operand[lane] = pull(lane);
+        });
+        apply(_a, load);
+        return;
+    case Instruction::PLP:
+        each([this](const size_t lane) {
+            read(lane, _pc[lane]);
+            read(lane, 0x0100 | _sp[lane]);
+            _p[lane] = pull(lane) & ~0x30;
+        });
+        return;
+
+    default: break;
+    }
+
+    // All the remaining instructions are implicit and take two cycles, the dummy read has no effect on the memory
+    for (size_t lane = 0; lane < max_lanes; ++lane) _cycle[lane] += _selected[lane] & 1;
+
+    const auto set_flags = [this](const uint8_t clear, const uint8_t set) {
+        for (size_t lane = 0; lane < max_lanes; ++lane)
+            _p[lane] = blend(_selected[lane], static_cast<uint8_t>((_p[lane] & ~clear) | set), _p[lane]);
+    };
+    const auto transfer = [this, &load](Lanes<uint8_t> &target, const Lanes<uint8_t> &source) {
+        _operand = source;
+        apply(target, load);
+    };
+
+    switch (instruction) {
+    case Instruction::CLC: set_flags(C, 0); return;
+    case Instruction::CLD: set_flags(D, 0); return;
+    case Instruction::CLI: set_flags(I, 0); return;
+    case Instruction::CLV: set_flags(V, 0); return;
+    case Instruction::SEC: set_flags(0, C); return;
+    case Instruction::SED: set_flags(0, D); return;
+    case Instruction::SEI: set_flags(0, I); return;
+
+    case Instruction::TAX: transfer(_x, _a); return;
+    case Instruction::TAY: transfer(_y, _a); return;
+    case Instruction::TSX: transfer(_x, _sp); return;
+    case Instruction::TXA: transfer(_a, _x); return;
+    case Instruction::TXS:
+        for (size_t lane = 0; lane < max_lanes; ++lane) _sp[lane] = blend(_selected[lane], _x[lane], _sp[lane]);
+        return;
+    case Instruction::TYA: transfer(_a, _y); return;
+
+    case Instruction::INX: apply(_x, increment); return;
+    case Instruction::INY: apply(_y, increment); return;
+    case Instruction::DEX: apply(_x, decrement); return;
+    case Instruction::DEY: apply(_y, decrement); return;
+
+    case Instruction::NOP: return;
+    default: std::unreachable();
+    }
+}
+} // namespace emulator::mos_6502
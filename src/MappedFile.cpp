@@ -0,0 +1,55 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "MappedFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <utility>
+
+namespace emulator::mos_6502 {
+MappedFile::MappedFile(const std::byte *data, const size_t size) noexcept : _data(data), _size(size) {}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept
+        : _data(std::exchange(other._data, nullptr)),
+          _size(std::exchange(other._size, 0)) {}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+    std::swap(_data, other._data);
+    std::swap(_size, other._size);
+    return *this;
+}
+
+MappedFile::~MappedFile() noexcept {
+    if (_data) munmap(const_cast<std::byte *>(_data), _size);
+}
+
+std::optional<MappedFile> MappedFile::open(const std::filesystem::path &path) noexcept {
+    const int descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) return std::nullopt;
+
+    std::error_code error;
+    const auto size = std::filesystem::file_size(path, error);
+    if (error) {
+        close(descriptor);
+        return std::nullopt;
+    }
+    if (size == 0) { // an empty mapping is not allowed
+        close(descriptor);
+        return MappedFile{ nullptr, 0 };
+    }
+
+    void *data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+    close(descriptor); // the mapping keeps the file alive
+    if (data == MAP_FAILED) return std::nullopt;
+
+    madvise(data, size, MADV_SEQUENTIAL);
+    return MappedFile{ static_cast<const std::byte *>(data), size };
+}
+
+std::span<const std::byte> MappedFile::bytes() const noexcept { return { _data, _size }; }
+
+std::string_view MappedFile::text() const noexcept { return { reinterpret_cast<const char *>(_data), _size }; }
+} // namespace emulator::mos_6502
@@ -3,30 +3,149 @@
 //
 
 #include "Memory.hpp"
+#include "MemoryPool.hpp"
 
 #include <algorithm>
+#include <bit>
+#include <cassert>
+#include <utility>
 
 namespace emulator::mos_6502 {
-Memory::Memory(const Data &data) noexcept : _data(data) {}
+namespace {
+/**
+ * @brief Term of a byte at an address in the hash of its page
+ *
+ * The finalizer of SplitMix64 makes the terms of all the address and value pairs independent enough
+ * for their sums to collide only by chance.
+ */
+uint64_t term(const uint16_t address, const uint8_t value) noexcept {
+    auto x = (static_cast<uint64_t>(address) << 8 | value) + 0x9E3779B97F4A7C15;
+    x      = (x ^ x >> 30) * 0xBF58476D1CE4E5B9;
+    x      = (x ^ x >> 27) * 0x94D049BB133111EB;
+    return x ^ x >> 31;
+}
+
+/**
+ * @brief Hash of a page filled with a value
+ */
+uint64_t filled_page(const size_t page, const uint8_t value) noexcept {
+    uint64_t hash = 0;
+    for (size_t offset = 0; offset < 256; ++offset) hash += term(static_cast<uint16_t>(page << 8 | offset), value);
+    return hash;
+}
+} // namespace
+
+Memory::Memory() : _data(MemoryPool::instance().acquire(true)) {
+    // Every zeroed memory has the same hashes, so they are only computed once
+    static const auto zeros = [] {
+        std::array<uint64_t, 256> hashes{};
+        for (size_t page = 0; page < hashes.size(); ++page) hashes[page] = filled_page(page, 0);
+        return hashes;
+    }();
+    _hashes = zeros;
+    for (const auto hash : _hashes) _digest += hash;
+}
+
+Memory::Memory(const Data &data) : _data(MemoryPool::instance().acquire(false)) {
+    *_data = data;
+    rehash();
+}
+
+Memory::Memory(const Data &data, std::unordered_set<uint16_t> rom_masks)
+        : _data(MemoryPool::instance().acquire(false)),
+          _rom_masks(std::move(rom_masks)) {
+    *_data = data;
+    rehash();
+}
+
+Memory::Memory(const Memory &other)
+        : _data(MemoryPool::instance().acquire(false)),
+          _rom_masks(other._rom_masks),
+          _dirty(other._dirty),
+          _modified(other._modified),
+          _hashes(other._hashes),
+          _digest(other._digest) {
+    assert(other._data && "the memory was moved from");
+    *_data = *other._data;
+}
 
-Memory::Memory(const Data &data, std::unordered_set<uint16_t> rom_masks) noexcept
-        : _data(data),
-          _rom_masks(std::move(rom_masks)) {}
+Memory &Memory::operator=(const Memory &other) {
+    assert(other._data && "the memory was moved from");
+    if (this == &other) return *this;
+    if (!_data) {
+        _data.reset(MemoryPool::instance().acquire(false));
+        _modified.fill(~uint64_t{ 0 });
+    }
+    // The pages that change are modified as if they were written, so that the observers of the writes see them
+    for (size_t first = 0; first < _data->size(); first += 256) {
+        const auto begin = static_cast<ptrdiff_t>(first);
+        if (!std::equal(_data->begin() + begin, _data->begin() + begin + 256, other._data->begin() + begin))
+            _modified[first >> 14] |= uint64_t{ 1 } << (first >> 8 & 63);
+    }
+    *_data     = *other._data;
+    _rom_masks = other._rom_masks;
+    _dirty     = other._dirty;
+    _hashes    = other._hashes;
+    _digest    = other._digest;
+    return *this;
+}
 
-Memory Memory::Commodore64(const Data &data) noexcept { return { data, { 0xA000, 0xD000 } }; }
+Memory Memory::Commodore64(const Data &data) { return { data, { 0xA000, 0xD000 } }; }
 
-Memory Memory::AppleII(const Data &data) noexcept { return { data, {0xC000} };
+Memory Memory::AppleII(const Data &data) { return { data, {0xC000} };
 }
 
-uint8_t Memory::operator[](const uint16_t address) const noexcept { return _data[address]; }
+uint8_t Memory::operator[](const uint16_t address) const noexcept { return (*_data)[address]; }
 
 bool Memory::write(const uint16_t address, const uint8_t value) noexcept {
     if (within_rom(address)) return false;
-    _data[address] = value;
+    auto &cell = (*_data)[address];
+    if (cell != value) {
+        const auto difference = term(address, value) - term(address, cell);
+        _hashes[address >> 8] += difference;
+        _digest += difference;
+        cell = value;
+    }
+    const auto page = uint64_t{ 1 } << (address >> 8 & 63);
+    _dirty[address >> 14] |= page;
+    _modified[address >> 14] |= page;
     return true;
 }
 
+void Memory::restore(const Memory &image) noexcept {
+    for (size_t word = 0; word < _dirty.size(); ++word)
+        for (auto pages = std::exchange(_dirty[word], 0); pages != 0; pages &= pages - 1) {
+            const auto first = (word << 14) + (static_cast<size_t>(std::countr_zero(pages)) << 8);
+            std::copy_n(image._data->begin() + static_cast<ptrdiff_t>(first), 256,
+                        _data->begin() + static_cast<ptrdiff_t>(first));
+            const auto page = first >> 8;
+            _digest += image._hashes[page] - _hashes[page];
+            _hashes[page] = image._hashes[page];
+            _modified[word] |= uint64_t{ 1 } << (page & 63);
+        }
+}
+
+std::array<uint64_t, 4> Memory::take_modified() noexcept { return std::exchange(_modified, {}); }
+
+uint64_t Memory::digest() const noexcept { return _digest; }
+
+uint64_t Memory::page_digest(const uint8_t page) const noexcept { return _hashes[page]; }
+
+void Memory::Recycle::operator()(Data *const block) const noexcept { MemoryPool::instance().release(block); }
+
 bool Memory::within_rom(const uint16_t address) const noexcept {
     return std::ranges::any_of(_rom_masks, [address](const uint16_t mask) { return (address & mask) == mask; });
 }
+
+void Memory::rehash() noexcept {
+    _digest = 0;
+    for (size_t page = 0; page < _hashes.size(); ++page) {
+        _hashes[page] = 0;
+        for (size_t offset = 0; offset < 256; ++offset) {
+            const auto address = static_cast<uint16_t>(page << 8 | offset);
+            _hashes[page] += term(address, (*_data)[address]);
+        }
+        _digest += _hashes[page];
+    }
+}
 } // namespace emulator::mos_6502
\ No newline at end of file
@@ -0,0 +1,90 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "MemoryPool.hpp"
+
+#include <cstring>
+#include <new>
+#include <sys/mman.h>
+
+namespace emulator::mos_6502 {
+MemoryPool &MemoryPool::instance() noexcept {
+    static MemoryPool pool;
+    return pool;
+}
+
+MemoryPool::~MemoryPool() noexcept {
+    for (auto *const arena : _arenas) munmap(arena, arena_size);
+}
+
+Memory::Data *MemoryPool::acquire(const bool zeroed) {
+    const std::scoped_lock lock(_mutex);
+
+    // Recycled blocks are preferred, because their pages are already backed
+    if (!_free.empty()) {
+        auto *const block = _free.back();
+        _free.pop_back();
+        if (zeroed) std::memset(block->data(), 0, block->size());
+        return block;
+    }
+
+    if (_fresh.empty()) grow();
+    auto *const block = _fresh.back();
+    _fresh.pop_back();
+    return block; // the kernel provides zero pages
+}
+
+void MemoryPool::release(Memory::Data *const block) noexcept {
+    const std::scoped_lock lock(_mutex);
+    _free.push_back(block);
+}
+
+size_t MemoryPool::arenas() const noexcept {
+    const std::scoped_lock lock(_mutex);
+    return _arenas.size();
+}
+
+size_t MemoryPool::available() const noexcept {
+    const std::scoped_lock lock(_mutex);
+    return _free.size() + _fresh.size();
+}
+
+size_t MemoryPool::huge_arenas() const noexcept {
+    const std::scoped_lock lock(_mutex);
+    return _huge_arenas;
+}
+
+void MemoryPool::grow() {
+    // Reserve the growth first, so that the bookkeeping cannot fail after the arena is mapped
+    _arenas.reserve(_arenas.size() + 1);
+    _free.reserve((_arenas.size() + 1) * blocks_per_arena);
+    _fresh.reserve(blocks_per_arena);
+
+    void *arena = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    arena = mmap(nullptr, arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (arena != MAP_FAILED) ++_huge_arenas;
+#endif
+    if (arena == MAP_FAILED) {
+        // Map twice the size to cut out an aligned arena, which the kernel can back by a transparent huge page
+        auto *const region = static_cast<std::byte *>(
+            mmap(nullptr, 2 * arena_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        if (region == MAP_FAILED) throw std::bad_alloc();
+
+        const auto address = reinterpret_cast<uintptr_t>(region);
+        const auto aligned = (address + arena_size - 1) & ~(arena_size - 1);
+        if (aligned != address) munmap(region, aligned - address);
+        munmap(reinterpret_cast<std::byte *>(aligned) + arena_size, address + arena_size - aligned);
+        arena = reinterpret_cast<void *>(aligned);
+#ifdef MADV_HUGEPAGE
+        madvise(arena, arena_size, MADV_HUGEPAGE);
+#endif
+    }
+
+    _arenas.push_back(static_cast<std::byte *>(arena));
+    // The blocks are taken from the back, so the arena is filled from its beginning
+    for (size_t i = blocks_per_arena; i-- > 0;)
+        _fresh.push_back(reinterpret_cast<Memory::Data *>(static_cast<std::byte *>(arena) + i * sizeof(Memory::Data)));
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,129 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Profiler.hpp"
+
+#include <new>
+#include <string>
+
+namespace emulator::mos_6502 {
+namespace {
+constexpr uint8_t JSR = 0x20;
+constexpr uint8_t RTS = 0x60;
+constexpr uint8_t BRK = 0x00;
+constexpr uint8_t RTI = 0x40;
+} // namespace
+
+Profiler::Profiler() : _addresses(std::make_unique<std::array<Counter, 0x10000>>()) {
+    // The stack pointers of the frames strictly decrease from the outermost one, so there are at most 256 of them
+    _stack.reserve(0x100);
+    clear();
+}
+
+void Profiler::record(const uint16_t pc,
+                      const uint8_t opcode,
+                      const uint8_t sp,
+                      const size_t cycles,
+                      const uint16_t target,
+                      const uint8_t next_sp) noexcept {
+    auto &address = (*_addresses)[pc];
+    address.hits++;
+    address.cycles += cycles;
+    _opcodes[opcode].hits++;
+    _opcodes[opcode].cycles += cycles;
+
+    switch (opcode) {
+    case JSR:
+    case BRK:
+        unwind(sp); // the stack might have been reset since the outer calls, and the caller is charged for the call
+        _nodes[_current].cycles += cycles;
+        call(target, sp);
+        return;
+    case RTS:
+    case RTI:
+        _nodes[_current].cycles += cycles;
+        unwind(next_sp);
+        return;
+    default: _nodes[_current].cycles += cycles; return;
+    }
+}
+
+void Profiler::record_interrupt(const uint8_t sp, const size_t cycles, const uint16_t handler) noexcept {
+    unwind(sp);
+    _nodes[_current].cycles += cycles;
+    call(handler, sp);
+}
+
+void Profiler::call(const uint16_t routine, const uint8_t sp) noexcept {
+    auto node = _current;
+    try {
+        // The room for a new node is made first, so that a failure leaves the tree as it was
+        if (_nodes.size() == _nodes.capacity()) _nodes.reserve(2 * _nodes.size());
+        const auto key         = static_cast<uint64_t>(_current) << 16 | routine;
+        auto [child, inserted] = _children.try_emplace(key, static_cast<uint32_t>(_nodes.size()));
+        if (inserted) _nodes.push_back({ .parent = _current, .routine = routine, .cycles = 0 });
+        node = child->second;
+    } catch (const std::bad_alloc &) {
+        _overflowed = true; // the routine is charged to the caller, but its frame is still tracked
+    }
+
+    _stack.push_back({ .node = node, .sp = sp });
+    _current = node;
+}
+
+void Profiler::unwind(const uint8_t sp) noexcept {
+    while (!_stack.empty() && _stack.back().sp <= sp) _stack.pop_back();
+    _current = _stack.empty() ? 0 : _stack.back().node;
+}
+
+Profiler::Counter Profiler::at(const uint16_t pc) const noexcept { return (*_addresses)[pc]; }
+
+std::array<Profiler::Counter, Profiler::instruction_count> Profiler::instructions() const noexcept {
+    std::array<Counter, instruction_count> result{};
+    for (size_t opcode = 0; opcode < _opcodes.size(); ++opcode) {
+        const auto instruction = getInstruction(static_cast<uint8_t>(opcode));
+        if (!instruction) continue;
+        auto &counter = result[static_cast<size_t>(*instruction)];
+        counter.hits += _opcodes[opcode].hits;
+        counter.cycles += _opcodes[opcode].cycles;
+    }
+    return result;
+}
+
+bool Profiler::overflowed() const noexcept { return _overflowed; }
+
+void Profiler::clear() noexcept {
+    _addresses->fill({});
+    _opcodes.fill({});
+    _nodes.assign(1, Node{});
+    _children.clear();
+    _stack.clear();
+    _current    = 0;
+    _overflowed = false;
+}
+
+void Profiler::write_collapsed_stacks(std::ostream &stream) const {
+    std::vector<std::string> paths(_nodes.size());
+    paths[0] = "root";
+    // Every node is created after its parent, so the parent's path is always ready
+    for (size_t i = 1; i < _nodes.size(); ++i) {
+        static constexpr char digits[] = "0123456789ABCDEF";
+        const auto routine             = _nodes[i].routine;
+        paths[i] = paths[_nodes[i].parent] + ';' + digits[routine >> 12] + digits[routine >> 8 & 0xF]
+                 + digits[routine >> 4 & 0xF] + digits[routine & 0xF];
+    }
+
+    for (size_t i = 0; i < _nodes.size(); ++i)
+        if (_nodes[i].cycles > 0) stream << paths[i] << ' ' << _nodes[i].cycles << '\n';
+}
+
+void Profiler::write_instruction_histogram(std::ostream &stream) const {
+    const auto histogram = instructions();
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        if (histogram[i].hits == 0) continue;
+        stream << getMnemonic(static_cast<Instruction>(i)) << ' ' << histogram[i].hits << ' ' << histogram[i].cycles
+               << '\n';
+    }
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,174 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Rewind.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+
+namespace emulator::mos_6502 {
+namespace {
+using Page = std::array<uint8_t, 256>;
+
+/// @brief The highest bit of a token marks a run of zeros, otherwise literal bytes follow it
+constexpr uint8_t zeros = 0x80;
+
+/// @brief Longest run a single token describes
+constexpr size_t longest = 0x80;
+
+/**
+ * @brief Append a page in the form of runs of zeros and of literal bytes, at most 128 of them per token
+ */
+void compress(const Page &page, std::vector<uint8_t> &output) {
+    for (size_t i = 0; i < page.size();) {
+        auto end = i;
+        if (page[i] == 0) {
+            while (end < page.size() && end - i < longest && page[end] == 0) ++end;
+            output.push_back(static_cast<uint8_t>(zeros | (end - i - 1)));
+        } else {
+            // A single zero between literals costs less as a literal than as a run
+            while (end < page.size() && end - i < longest
+                   && (page[end] != 0 || (end + 1 < page.size() && page[end + 1] != 0)))
+                ++end;
+            output.push_back(static_cast<uint8_t>(end - i - 1));
+            output.insert(output.end(), page.begin() + static_cast<ptrdiff_t>(i),
+                          page.begin() + static_cast<ptrdiff_t>(end));
+        }
+        i = end;
+    }
+}
+
+/**
+ * @brief Decode a page produced by @link compress @endlink
+ *
+ * @param input Start of the page, advanced past it
+ */
+void decompress(const uint8_t *&input, Page &page) noexcept {
+    for (size_t i = 0; i < page.size();) {
+        const auto token  = *input++;
+        const auto length = static_cast<size_t>(token & ~zeros) + 1;
+        if (token & zeros) {
+            std::fill_n(page.begin() + static_cast<ptrdiff_t>(i), length, 0);
+        } else {
+            std::copy_n(input, length, page.begin() + static_cast<ptrdiff_t>(i));
+            input += length;
+        }
+        i += length;
+    }
+}
+} // namespace
+
+Rewind::Rewind(const size_t interval, const size_t capacity) noexcept : _interval(interval), _capacity(capacity) {}
+
+bool Rewind::run(CPU &cpu, const size_t cycles) {
+    const auto end = cpu.cycle() + cycles;
+    if (!_latest) capture(cpu);
+    while (cpu.cycle() < end) {
+        if (!cpu.step()) return false;
+        if (cpu.cycle() >= _latest->cycle + _interval) capture(cpu);
+    }
+    return true;
+}
+
+void Rewind::capture(CPU &cpu) {
+    auto &memory        = cpu.memory();
+    const auto modified = memory.take_modified();
+    if (!_latest) {
+        _latest = cpu.snapshot();
+        return;
+    }
+
+    _scratch.clear();
+    for (size_t word = 0; word < modified.size(); ++word)
+        for (auto pages = modified[word]; pages != 0; pages &= pages - 1) {
+            const auto index = word << 6 | static_cast<size_t>(std::countr_zero(pages));
+            Page delta;
+            bool changed = false;
+            for (size_t offset = 0; offset < delta.size(); ++offset) {
+                const auto address = static_cast<uint16_t>(index << 8 | offset);
+                const auto value   = memory[address];
+                delta[offset]      = value ^ _latest->memory[address];
+                if (delta[offset] == 0) continue;
+                changed = true;
+                _latest->memory.write(address, value);
+            }
+            if (!changed) continue;
+            _scratch.push_back(static_cast<uint8_t>(index));
+            compress(delta, _scratch);
+        }
+
+    _entries.push_back({ .registers  = _latest->registers,
+                         .cycle      = _latest->cycle,
+                         .irq_masked = _latest->irq_masked,
+                         .delta      = { _scratch.begin(), _scratch.end() } });
+    _bytes += sizeof(Entry) + _entries.back().delta.size();
+
+    _latest->registers  = cpu.registers();
+    _latest->cycle      = cpu.cycle();
+    _latest->irq_masked = cpu.irq_masked();
+
+    while (_bytes > _capacity && !_entries.empty()) {
+        _bytes -= sizeof(Entry) + _entries.front().delta.size();
+        _entries.pop_front();
+    }
+}
+
+bool Rewind::rewind(CPU &cpu, const size_t cycles) {
+    if (!_latest) return false;
+
+    const auto target = cpu.cycle() - std::min(cycles, cpu.cycle());
+    if (_latest->cycle > target) {
+        // The latest entry captured at or before the target
+        const auto after = std::ranges::upper_bound(_entries, target, {}, &Entry::cycle);
+        if (after == _entries.begin()) return false;
+        const auto keep = static_cast<size_t>(std::distance(_entries.begin(), after)) - 1;
+        while (_entries.size() > keep) {
+            apply(_entries.back());
+            pop();
+        }
+    }
+
+    cpu.restore(*_latest);
+    static_cast<void>(cpu.memory().take_modified());
+    return true;
+}
+
+void Rewind::clear() noexcept {
+    _entries.clear();
+    _latest.reset();
+    _bytes = 0;
+}
+
+size_t Rewind::size() const noexcept { return _entries.size() + (_latest ? 1 : 0); }
+
+size_t Rewind::oldest() const noexcept {
+    if (!_entries.empty()) return _entries.front().cycle;
+    return _latest ? _latest->cycle : 0;
+}
+
+size_t Rewind::bytes() const noexcept { return _bytes; }
+
+void Rewind::apply(const Entry &entry) noexcept {
+    Page delta;
+    for (const auto *input = entry.delta.data(); input != entry.delta.data() + entry.delta.size();) {
+        const auto index = static_cast<size_t>(*input++);
+        decompress(input, delta);
+        for (size_t offset = 0; offset < delta.size(); ++offset) {
+            if (delta[offset] == 0) continue;
+            const auto address = static_cast<uint16_t>(index << 8 | offset);
+            _latest->memory.write(address, _latest->memory[address] ^ delta[offset]);
+        }
+    }
+
+    _latest->registers  = entry.registers;
+    _latest->cycle      = entry.cycle;
+    _latest->irq_masked = entry.irq_masked;
+}
+
+void Rewind::pop() noexcept {
+    _bytes -= sizeof(Entry) + _entries.back().delta.size();
+    _entries.pop_back();
+}
+} // namespace emulator::mos_6502
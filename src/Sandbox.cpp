@@ -0,0 +1,68 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Sandbox.hpp"
+
+namespace emulator::mos_6502 {
+Sandbox::Sandbox(const Memory &image, const uint16_t exit)
+        : _image(image),
+          _cpu(std::make_unique<CPU>(std::chrono::nanoseconds(0), image)),
+          _guard(std::make_unique<Guard>()),
+          _exit(std::make_unique<Breakpoints>()),
+          _exit_address(exit) {
+    _cpu->set_guard(_guard.get());
+    _cpu->set_breakpoints(_exit.get());
+}
+
+void Sandbox::permit(const uint8_t first_page, const uint8_t last_page,
+                     const std::initializer_list<Access> accesses) noexcept {
+    _guard->permit(first_page, last_page, accesses);
+}
+
+void Sandbox::reset() noexcept { _cpu->memory().restore(_image); }
+
+void Sandbox::load(uint16_t address, const std::span<const uint8_t> bytes) noexcept {
+    for (const auto byte : bytes) _cpu->memory().write(address++, byte);
+}
+
+Sandbox::Outcome Sandbox::call(const uint16_t entry, const Limits &limits) noexcept {
+    // The return address is pushed like JSR does, pointing at the byte before the exit
+    const auto return_address = static_cast<uint16_t>(_exit_address - 1);
+    _cpu->memory().write(0x01FF, static_cast<uint8_t>(return_address >> 8));
+    _cpu->memory().write(0x01FE, static_cast<uint8_t>(return_address));
+
+    CPU::Registers registers;
+    registers.PC           = entry;
+    registers.SP           = 0xFD;
+    registers.SR.interrupt = true;
+    _cpu->set_registers(registers);
+
+    _guard->clear();
+    _guard->set_write_budget(limits.writes);
+    // Clearing also forgets a previous stop at the exit, which would be passed otherwise
+    _exit->clear();
+    _exit->add(Access::Execute, _exit_address);
+
+    const auto start   = _cpu->cycle();
+    const bool running = _cpu->run(limits.cycles);
+
+    Outcome outcome{ .termination = Termination::CycleBudget,
+                     .registers   = _cpu->registers(),
+                     .cycles      = _cpu->cycle() - start,
+                     .writes      = _guard->writes(),
+                     .violation   = _guard->violation() };
+    if (running) return outcome;
+
+    if (_exit->hit()) outcome.termination = Termination::Returned;
+    else if (!outcome.violation) outcome.termination = Termination::Jammed;
+    else if (outcome.violation->kind == Guard::Violation::Kind::WriteBudget)
+        outcome.termination = Termination::WriteBudget;
+    else outcome.termination = Termination::AccessViolation;
+    return outcome;
+}
+
+void Sandbox::set_edge_coverage(EdgeCoverage *const edges) noexcept { _cpu->set_edge_coverage(edges); }
+
+const Memory &Sandbox::memory() const noexcept { return _cpu->memory(); }
+} // namespace emulator::mos_6502
@@ -0,0 +1,85 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Scheduler.hpp"
+
+#include <algorithm>
+
+namespace emulator::mos_6502 {
+void Scheduler::add(Device &device) {
+    // The nodes of the map keep their addresses, so the events can point at the positions of their devices
+    _heap.reserve(_positions.size() + 1);
+    _positions.try_emplace(&device, idle);
+}
+
+void Scheduler::map(Device &device, const uint8_t first_page, const uint8_t last_page) {
+    add(device);
+    std::fill(_pages.begin() + first_page, _pages.begin() + last_page + 1, &device);
+}
+
+void Scheduler::unmap(const uint8_t first_page, const uint8_t last_page) noexcept {
+    std::fill(_pages.begin() + first_page, _pages.begin() + last_page + 1, nullptr);
+}
+
+bool Scheduler::mapped() const noexcept {
+    return std::ranges::any_of(_pages, [](const Device *const device) { return device != nullptr; });
+}
+
+bool Scheduler::schedule(Device &device, const size_t cycle) noexcept {
+    const auto it = _positions.find(&device);
+    if (it == _positions.end()) return false;
+
+    // The pending event is replaced in place, so the heap never holds more than one event per device
+    auto &position = it->second;
+    if (position == idle) {
+        position = _heap.size();
+        _heap.push_back({ .cycle = cycle, .device = &device, .position = &position }); // within the capacity
+    } else
+        _heap[position].cycle = cycle;
+    restore_heap(position);
+    return true;
+}
+
+void Scheduler::cancel(Device &device) noexcept {
+    const auto it = _positions.find(&device);
+    if (it != _positions.end() && it->second != idle) remove(it->second);
+}
+
+void Scheduler::dispatch(const size_t cycle) noexcept {
+    while (!_heap.empty() && _heap.front().cycle <= cycle) {
+        auto *const device = _heap.front().device;
+        remove(0);
+        device->synchronize(cycle);
+    }
+}
+
+void Scheduler::place(const size_t index, const Event &event) noexcept {
+    _heap[index]    = event;
+    *event.position = index;
+}
+
+void Scheduler::restore_heap(size_t index) noexcept {
+    const auto event = _heap[index];
+    while (index > 0 && event.cycle < _heap[(index - 1) / 2].cycle) {
+        place(index, _heap[(index - 1) / 2]);
+        index = (index - 1) / 2;
+    }
+    for (auto child = 2 * index + 1; child < _heap.size(); child = 2 * index + 1) {
+        if (child + 1 < _heap.size() && _heap[child + 1].cycle < _heap[child].cycle) ++child;
+        if (_heap[child].cycle >= event.cycle) break;
+        place(index, _heap[child]);
+        index = child;
+    }
+    place(index, event);
+}
+
+void Scheduler::remove(const size_t index) noexcept {
+    *_heap[index].position = idle;
+    const auto last        = _heap.back();
+    _heap.pop_back();
+    if (index == _heap.size()) return;
+    place(index, last);
+    restore_heap(index);
+}
+} // namespace emulator::mos_6502
@@ -0,0 +1,128 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Search.hpp"
+
+#include <algorithm>
+#include <ranges>
+#include <thread>
+#include <utility>
+
+namespace emulator::mos_6502 {
+Search::Search(Options options) noexcept : _options(std::move(options)) {
+    if (_options.threads == 0) _options.threads = std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+Search::Result Search::run(const CPU::Snapshot &start, const Objective &objective) {
+    _table.clear();
+    _trails.clear();
+    _frontier.clear();
+    _duplicates = 0;
+
+    Result result;
+    const auto finish = [&](const std::optional<Node> &node) {
+        if (node) {
+            result.found = true;
+            for (auto trail = node->trail; trail != root; trail = _trails[trail].parent)
+                result.inputs.push_back(_trails[trail].input);
+            std::ranges::reverse(result.inputs);
+            result.state = node->state;
+        }
+        result.states     = _table.size();
+        result.duplicates = _duplicates;
+        _frontier.clear();
+        _forks.clear();
+        return result;
+    };
+
+    auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), start.memory);
+    cpu->restore(start);
+    _table.insert(cpu->digest());
+    if (objective.goal(start.memory)) return finish(Node{ .state = start, .trail = root });
+
+    _frontier.push_back({ .state = start, .trail = root, .score = objective.score(start.memory) });
+    for (size_t level = 0; level < _options.depth && !_frontier.empty(); ++level)
+        if (const auto goal = expand(objective)) return finish(std::move(_forks[*goal]));
+    return finish(std::nullopt);
+}
+
+std::optional<size_t> Search::expand(const Objective &objective) {
+    const auto count = _frontier.size() * _options.candidates.size();
+    _forks.assign(count, std::nullopt);
+    _reached.assign(count, 0);
+    _digests.assign(count, 0);
+    _next = 0;
+
+    {
+        const auto threads = std::min<size_t>(_options.threads, count);
+        std::vector<std::unique_ptr<CPU>> cpus;
+        for (size_t i = 0; i < threads; ++i)
+            cpus.push_back(std::make_unique<CPU>(std::chrono::nanoseconds(0), _frontier.front().state.memory));
+        std::vector<std::jthread> workers;
+        for (size_t i = 1; i < threads; ++i)
+            workers.emplace_back([this, &objective, &cpu = *cpus[i]] { work(cpu, objective); });
+        if (threads != 0) work(*cpus[0], objective);
+    }
+    if (_failure) std::rethrow_exception(std::exchange(_failure, nullptr));
+
+    // The new states are added in the order of the level, so that the result does not depend on the scheduling
+    std::optional<size_t> goal;
+    for (size_t i = 0; i < count; ++i) {
+        if (!_forks[i] || !_table.insert(_digests[i]).second) {
+            _forks[i].reset();
+            ++_duplicates;
+        } else if (!goal && _reached[i]) {
+            goal = i;
+        }
+    }
+    if (goal) {
+        _trails.push_back({ .parent = _frontier[*goal / _options.candidates.size()].trail,
+                            .input  = _options.candidates[*goal % _options.candidates.size()] });
+        _forks[*goal]->trail = _trails.size() - 1;
+        return goal;
+    }
+
+    std::vector<Node> next;
+    for (size_t i = 0; i < count; ++i) {
+        if (!_forks[i]) continue;
+        _trails.push_back({ .parent = _frontier[i / _options.candidates.size()].trail,
+                            .input  = _options.candidates[i % _options.candidates.size()] });
+        _forks[i]->trail = _trails.size() - 1;
+        next.push_back(std::move(*_forks[i]));
+    }
+    _forks.clear();
+
+    if (_options.beam != 0 && next.size() > _options.beam) {
+        std::ranges::stable_sort(next, std::ranges::greater{}, &Node::score);
+        next.erase(next.begin() + static_cast<ptrdiff_t>(_options.beam), next.end());
+    }
+    _frontier = std::move(next);
+    return std::nullopt;
+}
+
+void Search::work(CPU &cpu, const Objective &objective) noexcept {
+    const auto candidates = _options.candidates.size();
+    try {
+        for (auto index = _next.fetch_add(1, std::memory_order_relaxed); index < _forks.size();
+             index      = _next.fetch_add(1, std::memory_order_relaxed)) {
+            cpu.restore(_frontier[index / candidates].state);
+            cpu.memory().write(_options.input, _options.candidates[index % candidates]);
+            const auto end = cpu.cycle() + _options.frame;
+            while (cpu.cycle() < end)
+                if (!cpu.step()) break;
+
+            // The states of the previous levels are not snapshotted again, the new ones are deduplicated later
+            _digests[index] = cpu.digest();
+            if (_table.contains(_digests[index])) continue;
+
+            _forks[index]   = Node{ .state = cpu.snapshot(), .trail = root, .score = objective.score(cpu.memory()) };
+            _reached[index] = objective.goal(cpu.memory()) ? 1 : 0;
+        }
+    } catch (...) {
+        const std::scoped_lock lock(_failure_mutex);
+        if (!_failure) _failure = std::current_exception();
+        _next = _forks.size(); // the other workers stop after their current fork
+    }
+}
+} // namespace emulator::mos_6502
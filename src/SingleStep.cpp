@@ -0,0 +1,302 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "SingleStep.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+namespace emulator::mos_6502 {
+namespace {
+[[nodiscard]] constexpr bool is_whitespace(const char c) noexcept {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+/// @brief Bits of the status register that exist in hardware
+constexpr uint8_t status_mask = 0xCF;
+
+/**
+ * @brief Print a value in hexadecimal with a dollar sign, as the 6502 assemblers do
+ */
+struct Hex {
+    unsigned value;
+    int digits;
+};
+
+std::ostream &operator<<(std::ostream &stream, const Hex hex) {
+    return stream << '$' << std::uppercase << std::hex << std::setw(hex.digits) << std::setfill('0') << hex.value
+                  << std::dec;
+}
+
+std::ostream &operator<<(std::ostream &stream, const SingleStepTest::Cycle &cycle) {
+    return stream << (cycle.access == Access::Write ? "write " : "read ") << Hex{ cycle.address, 4 } << '='
+                  << Hex{ cycle.value, 2 };
+}
+} // namespace
+
+SingleStepReader::SingleStepReader(const std::string_view text) noexcept : _text(text) {}
+
+bool SingleStepReader::next(SingleStepTest &test) {
+    if (_failed || _finished) return false;
+
+    _failed  = _started ? !peek(']') && !consume(',') : !consume('[');
+    _started = true;
+    if (_failed) return false;
+
+    if (peek(']')) {
+        ++_position;
+        skip_whitespace();
+        _finished = true;
+        _failed   = _position != _text.size();
+        return false;
+    }
+    _failed = !this->test(test);
+    return !_failed;
+}
+
+bool SingleStepReader::failed() const noexcept { return _failed; }
+
+size_t SingleStepReader::position() const noexcept { return _position; }
+
+void SingleStepReader::skip_whitespace() noexcept {
+    while (_position < _text.size() && is_whitespace(_text[_position])) ++_position;
+}
+
+bool SingleStepReader::peek(const char c) noexcept {
+    skip_whitespace();
+    return _position < _text.size() && _text[_position] == c;
+}
+
+bool SingleStepReader::consume(const char c) noexcept {
+    if (!peek(c)) return false;
+    ++_position;
+    return true;
+}
+
+bool SingleStepReader::string(std::string_view &value) noexcept {
+    if (!consume('"')) return false;
+
+    const auto begin = _position;
+    for (; _position < _text.size(); ++_position) {
+        if (_text[_position] == '\\') ++_position; // the escaped character cannot end the string
+        else if (_text[_position] == '"') {
+            value = _text.substr(begin, _position++ - begin);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SingleStepReader::integer(unsigned &value, const unsigned maximum) noexcept {
+    skip_whitespace();
+    const auto begin = _position;
+    value            = 0;
+    for (; _position < _text.size() && _text[_position] >= '0' && _text[_position] <= '9'; ++_position) {
+        value = value * 10 + static_cast<unsigned>(_text[_position] - '0');
+        if (value > maximum) return false;
+    }
+    return _position != begin;
+}
+
+bool SingleStepReader::skip() noexcept {
+    std::string_view ignored;
+    if (peek('"')) return string(ignored);
+    if (!peek('[') && !peek('{')) {
+        // A number or a literal ends at a delimiter
+        const auto end = _text.find_first_of(",]} \n\r\t", _position);
+        if (end == _position) return false;
+        _position = std::min(end, _text.size());
+        return true;
+    }
+
+    // The nested containers are only matched by their depth, the strings are skipped as a whole
+    size_t depth = 0;
+    while (_position < _text.size()) {
+        const char c = _text[_position];
+        if (c == '"') {
+            if (!string(ignored)) return false;
+            continue;
+        }
+        ++_position;
+        if (c == '[' || c == '{') ++depth;
+        else if ((c == ']' || c == '}') && --depth == 0) return true;
+    }
+    return false;
+}
+
+bool SingleStepReader::state(SingleStepTest::State &state) {
+    state.registers = {};
+    state.ram.clear();
+    if (!consume('{')) return false;
+    if (consume('}')) return true;
+
+    do {
+        std::string_view key;
+        if (!string(key) || !consume(':')) return false;
+
+        unsigned value = 0;
+        if (key == "pc") {
+            if (!integer(value, 0xFFFF)) return false;
+            state.registers.PC = static_cast<uint16_t>(value);
+        } else if (key == "s" || key == "a" || key == "x" || key == "y" || key == "p") {
+            if (!integer(value, 0xFF)) return false;
+            const auto byte = static_cast<uint8_t>(value);
+            switch (key.front()) {
+            case 's': state.registers.SP = byte; break;
+            case 'a': state.registers.A = byte; break;
+            case 'x': state.registers.X = byte; break;
+            case 'y': state.registers.Y = byte; break;
+            default: state.registers.SR = StatusRegister::from_byte(byte); break;
+            }
+        } else if (key == "ram") {
+            if (!consume('[')) return false;
+            if (!consume(']')) {
+                do {
+                    unsigned address = 0;
+                    if (!consume('[') || !integer(address, 0xFFFF) || !consume(',') || !integer(value, 0xFF)
+                        || !consume(']'))
+                        return false;
+                    state.ram.emplace_back(static_cast<uint16_t>(address), static_cast<uint8_t>(value));
+                } while (consume(','));
+                if (!consume(']')) return false;
+            }
+        } else if (!skip()) return false;
+    } while (consume(','));
+    return consume('}');
+}
+
+bool SingleStepReader::cycles(std::vector<SingleStepTest::Cycle> &cycles) {
+    cycles.clear();
+    if (!consume('[')) return false;
+    if (consume(']')) return true;
+
+    do {
+        unsigned address = 0;
+        unsigned value   = 0;
+        std::string_view kind;
+        if (!consume('[') || !integer(address, 0xFFFF) || !consume(',') || !integer(value, 0xFF) || !consume(',')
+            || !string(kind) || !consume(']'))
+            return false;
+        if (kind != "read" && kind != "write") return false;
+        cycles.push_back({ .address = static_cast<uint16_t>(address),
+                           .value   = static_cast<uint8_t>(value),
+                           .access  = kind == "read" ? Access::Read : Access::Write });
+    } while (consume(','));
+    return consume(']');
+}
+
+bool SingleStepReader::test(SingleStepTest &test) {
+    test.name = {};
+    if (!consume('{')) return false;
+    if (consume('}')) return true;
+
+    do {
+        std::string_view key;
+        if (!string(key) || !consume(':')) return false;
+
+        bool parsed;
+        if (key == "name") parsed = string(test.name);
+        else if (key == "initial") parsed = state(test.initial);
+        else if (key == "final") parsed = state(test.final);
+        else if (key == "cycles") parsed = cycles(test.cycles);
+        else parsed = skip();
+        if (!parsed) return false;
+    } while (consume(','));
+    return consume('}');
+}
+
+SingleStepRunner::SingleStepRunner() : _cpu(std::chrono::nanoseconds(0), Memory{}) {
+    // An instruction never takes more cycles, so the logging never allocates
+    _bus.log.reserve(8);
+    _scheduler.map(_bus, 0x00, 0xFF);
+    _cpu.set_scheduler(&_scheduler);
+}
+
+SingleStepRunner::Result SingleStepRunner::run(const SingleStepTest &test) {
+    for (const auto &[address, value] : test.initial.ram) _bus.ram[address] = value;
+    _bus.log.clear();
+
+    // Every byte the case could have touched is zeroed for the next one
+    const auto clear = [this, &test] {
+        for (const auto &[address, value] : test.initial.ram) _bus.ram[address] = 0;
+        for (const auto &[address, value] : test.final.ram) _bus.ram[address] = 0;
+        for (const auto &cycle : _bus.log) _bus.ram[cycle.address] = 0;
+    };
+
+    const auto opcode = _bus.ram[test.initial.registers.PC];
+    if (!getInstruction(opcode) || !getAddressing(opcode)) {
+        clear();
+        return Result::Unsupported;
+    }
+
+    _cpu.set_registers(test.initial.registers);
+    const auto start = _cpu.cycle();
+    static_cast<void>(_cpu.step());
+    const auto cycles = _cpu.cycle() - start;
+
+    const auto &expected = test.final.registers;
+    const auto actual    = _cpu.registers();
+    const bool passed    = expected.PC == actual.PC && expected.SP == actual.SP && expected.A == actual.A
+                       && expected.X == actual.X && expected.Y == actual.Y
+                       && (expected.SR.to_byte() & status_mask) == (actual.SR.to_byte() & status_mask)
+                       && std::ranges::all_of(test.final.ram,
+                                              [this](const auto &byte) { return _bus.ram[byte.first] == byte.second; })
+                       && std::ranges::equal(test.cycles, _bus.log) && test.cycles.size() == cycles;
+    if (passed) {
+        clear();
+        return Result::Passed;
+    }
+
+    // The description is only composed for the failed cases, so that the passed ones do not allocate
+    std::ostringstream failure;
+    const auto compare = [&failure](const std::string_view name, const unsigned expected_value,
+                                    const unsigned actual_value, const int digits) {
+        if (expected_value != actual_value)
+            failure << name << ' ' << Hex{ expected_value, digits } << " expected, " << Hex{ actual_value, digits }
+                    << " found; ";
+    };
+    compare("PC", expected.PC, actual.PC, 4);
+    compare("SP", expected.SP, actual.SP, 2);
+    compare("A", expected.A, actual.A, 2);
+    compare("X", expected.X, actual.X, 2);
+    compare("Y", expected.Y, actual.Y, 2);
+    compare("P", expected.SR.to_byte() & status_mask, actual.SR.to_byte() & status_mask, 2);
+    for (const auto &[address, value] : test.final.ram)
+        if (_bus.ram[address] != value)
+            failure << '[' << Hex{ address, 4 } << "] " << Hex{ value, 2 } << " expected, "
+                    << Hex{ _bus.ram[address], 2 } << " found; ";
+
+    const auto [expected_cycle, actual_cycle] = std::ranges::mismatch(test.cycles, _bus.log);
+    if (expected_cycle != test.cycles.end() || actual_cycle != _bus.log.end()) {
+        failure << "cycle " << expected_cycle - test.cycles.begin() + 1 << ": ";
+        if (expected_cycle != test.cycles.end()) failure << *expected_cycle;
+        else failure << "none";
+        failure << " expected, ";
+        if (actual_cycle != _bus.log.end()) failure << *actual_cycle;
+        else failure << "none";
+        failure << " found; ";
+    }
+    if (test.cycles.size() != cycles)
+        failure << test.cycles.size() << " cycles expected, " << cycles << " taken; ";
+
+    clear();
+    _failure = std::move(failure).str();
+    _failure.resize(_failure.size() - 2); // the trailing separator
+    return Result::Failed;
+}
+
+const std::string &SingleStepRunner::failure() const noexcept { return _failure; }
+
+uint8_t SingleStepRunner::Bus::read(const uint16_t address) noexcept {
+    const auto value = ram[address];
+    log.push_back({ .address = address, .value = value, .access = Access::Read });
+    return value;
+}
+
+void SingleStepRunner::Bus::write(const uint16_t address, const uint8_t value) noexcept {
+    ram[address] = value;
+    log.push_back({ .address = address, .value = value, .access = Access::Write });
+}
+} // namespace emulator::mos_6502
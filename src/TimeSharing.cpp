@@ -0,0 +1,72 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "TimeSharing.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace emulator::mos_6502 {
+TimeSharing::TimeSharing(const size_t quantum) noexcept : _quantum(std::max<size_t>(quantum, 1)) {}
+
+size_t TimeSharing::spawn(std::unique_ptr<CPU> cpu, const unsigned priority, const size_t quota) {
+    _contexts.push_back(
+        { .cpu = std::move(cpu), .priority = std::max(priority, 1u), .quota = quota, .pass = _now });
+    const auto context = _contexts.size() - 1;
+    if (quota == 0) _contexts[context].state = State::Exhausted;
+    else enqueue(context);
+    return context;
+}
+
+bool TimeSharing::step() noexcept {
+    if (_ready.empty()) return false;
+
+    const auto order = [this](const size_t index) { return std::pair{ _contexts[index].pass, index }; };
+    std::ranges::pop_heap(_ready, std::ranges::greater{}, order);
+    auto &context = _contexts[_ready.back()];
+    _now          = context.pass;
+
+    const auto start   = context.cpu->cycle();
+    const auto running = context.cpu->run(std::min(_quantum, context.quota - context.consumed));
+    const auto cycles  = context.cpu->cycle() - start;
+    context.consumed += cycles;
+    context.pass     += cycles * stride / context.priority;
+
+    if (!running) context.state = State::Stopped;
+    else if (context.consumed >= context.quota) context.state = State::Exhausted;
+
+    if (context.state == State::Ready) std::ranges::push_heap(_ready, std::ranges::greater{}, order);
+    else _ready.pop_back();
+    return true;
+}
+
+void TimeSharing::run() noexcept {
+    while (step()) {}
+}
+
+void TimeSharing::set_quota(const size_t context, const size_t quota) {
+    auto &target = _contexts[context];
+    target.quota = quota;
+    if (target.state != State::Exhausted || target.consumed >= quota) return;
+
+    // The context did not run while exhausted, so it must not catch up on the others
+    target.state = State::Ready;
+    target.pass  = std::max(target.pass, _now);
+    enqueue(context);
+}
+
+CPU &TimeSharing::instance(const size_t context) noexcept { return *_contexts[context].cpu; }
+
+TimeSharing::State TimeSharing::state(const size_t context) const noexcept { return _contexts[context].state; }
+
+size_t TimeSharing::consumed(const size_t context) const noexcept { return _contexts[context].consumed; }
+
+void TimeSharing::enqueue(const size_t context) {
+    _ready.push_back(context);
+    std::ranges::push_heap(_ready, std::ranges::greater{}, [this](const size_t index) {
+        return std::pair{ _contexts[index].pass, index };
+    });
+}
+} // namespace emulator::mos_6502
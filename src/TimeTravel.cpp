@@ -0,0 +1,66 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "TimeTravel.hpp"
+
+#include <algorithm>
+
+namespace emulator::mos_6502 {
+TimeTravel::TimeTravel(CPU &cpu, const size_t interval)
+        : _cpu(cpu),
+          _journal(interval),
+          _origin(cpu.cycle()),
+          _frontier(cpu.cycle()) {
+    _cpu.set_journal(&_journal);
+    _cpu.set_write_log(&_write_log);
+    _journal.record(_cpu);
+}
+
+TimeTravel::~TimeTravel() noexcept {
+    _cpu.set_journal(nullptr);
+    _cpu.set_write_log(nullptr);
+}
+
+bool TimeTravel::step() {
+    if (_journal.mode() == Journal::Mode::Replay && _cpu.cycle() >= _frontier) static_cast<void>(_journal.resume());
+    const bool running = _cpu.step();
+    if (_journal.mode() == Journal::Mode::Record) _frontier = std::max(_frontier, _cpu.cycle());
+    return running;
+}
+
+bool TimeTravel::seek(const size_t cycle) {
+    // The recorded part is replayed from the closest snapshot, the rest is executed live
+    if ((cycle < _cpu.cycle() || _journal.mode() == Journal::Mode::Replay)
+        && !_journal.seek(_cpu, std::min(cycle, _frontier)))
+        return false;
+    while (_cpu.cycle() < cycle)
+        if (!step()) return false;
+    return true;
+}
+
+bool TimeTravel::reverse_step() {
+    const auto current = _cpu.cycle();
+    if (current <= _origin) return false;
+
+    // The instruction boundaries are only known by executing from a snapshot before the current cycle
+    const auto start = _journal.closest(current - 1);
+    if (!_journal.seek(_cpu, start)) return false;
+    auto previous = start;
+    while (_cpu.cycle() < current) {
+        previous = _cpu.cycle();
+        if (!_cpu.step()) return false; // a stopped instruction is not a boundary to return to
+    }
+    return _journal.seek(_cpu, previous);
+}
+
+std::optional<WriteLog::Write> TimeTravel::last_write(const uint16_t address, const size_t cycle) const noexcept {
+    return _write_log.last_write(address, cycle);
+}
+
+size_t TimeTravel::frontier() const noexcept { return _frontier; }
+
+const Journal &TimeTravel::journal() const noexcept { return _journal; }
+
+const WriteLog &TimeTravel::write_log() const noexcept { return _write_log; }
+} // namespace emulator::mos_6502
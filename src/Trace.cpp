@@ -0,0 +1,162 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Trace.hpp"
+
+#include <iomanip>
+
+namespace emulator::mos_6502 {
+namespace {
+/**
+ * @brief Parse a fixed number of hexadecimal digits at a given position
+ *
+ * @retval std::nullopt If the string is too short or contains a non-hexadecimal digit
+ */
+[[nodiscard]] std::optional<uint16_t> parse_hex(const std::string_view text,
+                                                const size_t position,
+                                                const size_t digits) noexcept {
+    if (position + digits > text.size()) return std::nullopt;
+
+    uint16_t result = 0;
+    for (size_t i = position; i < position + digits; ++i) {
+        const char c = text[i];
+        uint16_t digit;
+        if (c >= '0' && c <= '9') digit = static_cast<uint16_t>(c - '0');
+        else if (c >= 'A' && c <= 'F') digit = static_cast<uint16_t>(c - 'A' + 10);
+        else if (c >= 'a' && c <= 'f') digit = static_cast<uint16_t>(c - 'a' + 10);
+        else return std::nullopt;
+        result = static_cast<uint16_t>(result << 4 | digit);
+    }
+    return result;
+}
+
+/**
+ * @brief Parse a two-digit hexadecimal register value following a label, e.g. "A:"
+ *
+ * @param[in, out] position Where to start searching for the label. Is set past the value on success.
+ */
+[[nodiscard]] std::optional<uint8_t> parse_register(const std::string_view line,
+                                                    const std::string_view label,
+                                                    size_t &position) noexcept {
+    position = line.find(label, position);
+    if (position == std::string_view::npos) return std::nullopt;
+
+    position += label.size();
+    const auto value = parse_hex(line, position, 2);
+    position += 2;
+    return value ? std::make_optional(static_cast<uint8_t>(*value)) : std::nullopt;
+}
+} // namespace
+
+TraceRecord TraceRecord::capture(const CPU &cpu) noexcept {
+    const auto registers = cpu.registers();
+    return { .cycle  = cpu.cycle(),
+             .PC     = registers.PC,
+             .A      = registers.A,
+             .X      = registers.X,
+             .Y      = registers.Y,
+             .P      = static_cast<uint8_t>((registers.SR.to_byte() | 0x20) & ~0x10),
+             .SP     = registers.SP,
+             .opcode = cpu.memory()[registers.PC] };
+}
+
+std::optional<TraceRecord> TraceRecord::parse_reference(const std::string_view line) noexcept {
+    const auto pc     = parse_hex(line, 0, 4);
+    const auto opcode = parse_hex(line, 6, 2);
+    if (!pc || !opcode) return std::nullopt;
+
+    // The disassembly never contains a space followed by a register label, so searching is unambiguous
+    size_t position = 8;
+    const auto a    = parse_register(line, " A:", position);
+    if (!a) return std::nullopt;
+    const auto x = parse_register(line, " X:", position);
+    if (!x) return std::nullopt;
+    const auto y = parse_register(line, " Y:", position);
+    if (!y) return std::nullopt;
+    const auto p = parse_register(line, " P:", position);
+    if (!p) return std::nullopt;
+    const auto sp = parse_register(line, " SP:", position);
+    if (!sp) return std::nullopt;
+
+    position = line.find("CYC:", position);
+    if (position == std::string_view::npos) return std::nullopt;
+    uint64_t cycle = 0;
+    size_t digits  = 0;
+    for (position += 4; position < line.size() && line[position] >= '0' && line[position] <= '9'; ++position) {
+        cycle = cycle * 10 + static_cast<uint64_t>(line[position] - '0');
+        ++digits;
+    }
+    if (digits == 0) return std::nullopt;
+
+    return TraceRecord{ .cycle  = cycle,
+                        .PC     = *pc,
+                        .A      = *a,
+                        .X      = *x,
+                        .Y      = *y,
+                        .P      = *p,
+                        .SP     = *sp,
+                        .opcode = static_cast<uint8_t>(*opcode) };
+}
+
+bool TraceRecord::matches(const TraceRecord &reference) const noexcept {
+    static constexpr uint8_t flags_mask = 0xCF;
+    return cycle == reference.cycle && PC == reference.PC && A == reference.A && X == reference.X
+        && Y == reference.Y && (P & flags_mask) == (reference.P & flags_mask) && SP == reference.SP
+        && opcode == reference.opcode;
+}
+
+std::string TraceRecord::mismatches(const TraceRecord &reference) const {
+    static constexpr uint8_t flags_mask = 0xCF;
+
+    std::string result;
+    const auto append = [&result](const bool differs, const std::string_view name) {
+        if (!differs) return;
+        if (!result.empty()) result += ' ';
+        result += name;
+    };
+    append(PC != reference.PC, "PC");
+    append(opcode != reference.opcode, "opcode");
+    append(A != reference.A, "A");
+    append(X != reference.X, "X");
+    append(Y != reference.Y, "Y");
+    append((P & flags_mask) != (reference.P & flags_mask), "P");
+    append(SP != reference.SP, "SP");
+    append(cycle != reference.cycle, "CYC");
+    return result;
+}
+
+std::ostream &operator<<(std::ostream &stream, const TraceRecord &record) {
+    const auto flags = stream.flags();
+    const auto fill  = stream.fill('0');
+    stream << std::uppercase << std::hex << std::setw(4) << record.PC << "  " << std::setw(2)
+           << static_cast<int>(record.opcode) << "  A:" << std::setw(2) << static_cast<int>(record.A)
+           << " X:" << std::setw(2) << static_cast<int>(record.X) << " Y:" << std::setw(2)
+           << static_cast<int>(record.Y) << " P:" << std::setw(2) << static_cast<int>(record.P) << " SP:"
+           << std::setw(2) << static_cast<int>(record.SP) << std::dec << " CYC:" << record.cycle;
+    stream.fill(fill);
+    stream.flags(flags);
+    return stream;
+}
+
+TraceWriter::TraceWriter(const std::filesystem::path &path) noexcept
+        : _stream(path, std::ios::binary | std::ios::trunc) {
+    _buffer.reserve(buffer_size);
+}
+
+TraceWriter::~TraceWriter() noexcept { flush(); }
+
+void TraceWriter::record(const CPU &cpu) noexcept {
+    _buffer.push_back(TraceRecord::capture(cpu));
+    if (_buffer.size() == buffer_size) flush();
+}
+
+void TraceWriter::flush() noexcept {
+    _stream.write(reinterpret_cast<const char *>(_buffer.data()),
+                  static_cast<std::streamsize>(_buffer.size() * sizeof(TraceRecord)));
+    _stream.flush();
+    _buffer.clear();
+}
+
+bool TraceWriter::good() const noexcept { return _stream.good(); }
+} // namespace emulator::mos_6502
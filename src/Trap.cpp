@@ -0,0 +1,43 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "Trap.hpp"
+
+namespace emulator::mos_6502 {
+namespace {
+/**
+ * @brief Whether an opcode can loop to itself: a jump or a branch
+ *
+ * Other instructions may leave the program counter unchanged as well, e.g. an RTS that returns to itself
+ * after a subroutine call in the tail position, but they do not loop forever.
+ */
+[[nodiscard]] constexpr bool loops(const uint8_t opcode) noexcept {
+    return opcode == 0x4C || opcode == 0x6C || (opcode & 0x1F) == 0x10;
+}
+} // namespace
+
+Trap Trap::wait(CPU &cpu, const size_t limit) noexcept {
+    const auto start = cpu.cycle();
+    Trap trap{ .kind = Kind::Limit };
+    for (auto pc = cpu.registers().PC; cpu.cycle() - start < limit; ++trap.instructions) {
+        const auto opcode = cpu.memory()[pc];
+        if (!cpu.step()) {
+            trap.kind = Kind::Stopped;
+            break;
+        }
+
+        const auto next = cpu.registers().PC;
+        if (next == pc && loops(opcode)) {
+            trap.kind = Kind::Loop;
+            ++trap.instructions;
+            break;
+        }
+        pc = next;
+    }
+
+    trap.PC     = cpu.registers().PC;
+    trap.cycles = cpu.cycle() - start;
+    return trap;
+}
+} // namespace emulator::mos_6502
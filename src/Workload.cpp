@@ -0,0 +1,369 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "CPU.hpp"
+#include "Workload.hpp"
+
+#include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <numeric>
+#include <random>
+#include <utility>
+
+namespace emulator::mos_6502 {
+namespace {
+/// @brief Address of the entry point of every workload
+constexpr uint16_t origin = 0x0400;
+
+/**
+ * @brief Writer of machine code into an image that resolves the relative branches
+ */
+class Emitter {
+public:
+    Emitter(Memory::Data &image, const uint16_t address) noexcept : _image(image), _pc(address) {}
+
+    [[nodiscard]] uint16_t here() const noexcept { return _pc; }
+
+    /// @brief Emit an instruction as is
+    Emitter &operator()(const std::initializer_list<uint8_t> bytes) noexcept {
+        for (const auto byte : bytes) _image[_pc++] = byte;
+        return *this;
+    }
+
+    /// @brief Emit an instruction with an absolute address
+    Emitter &operator()(const uint8_t opcode, const uint16_t address) noexcept {
+        return (*this)({ opcode, static_cast<uint8_t>(address), static_cast<uint8_t>(address >> 8) });
+    }
+
+    /// @brief Emit a branch to an address that is already known
+    Emitter &branch(const uint8_t opcode, const uint16_t target) noexcept {
+        return (*this)({ opcode, static_cast<uint8_t>(target - (_pc + 2)) });
+    }
+
+    /// @brief Emit a branch whose target is to be set by @link land @endlink
+    [[nodiscard]] uint16_t forward(const uint8_t opcode) noexcept {
+        const auto address = _pc;
+        (*this)({ opcode, 0x00 });
+        return address;
+    }
+
+    /// @brief Make a forward branch jump to the current address
+    void land(const uint16_t branch) noexcept { _image[branch + 1] = static_cast<uint8_t>(_pc - (branch + 2)); }
+
+    /// @brief Emit the final @p JMP to itself and return its address
+    [[nodiscard]] uint16_t trap() noexcept {
+        const auto address = _pc;
+        (*this)(0x4C, address);
+        return address;
+    }
+
+private:
+    Memory::Data &_image;
+
+    uint16_t _pc;
+};
+
+/**
+ * @brief Add an empty workload that starts at the origin after a reset
+ */
+Workload &create(std::vector<Workload> &workloads, const std::string_view name, const std::string_view description) {
+    auto &workload               = workloads.emplace_back();
+    workload.name                = name;
+    workload.description         = description;
+    workload.entry               = origin;
+    workload.image[CPU::RES]     = static_cast<uint8_t>(origin);
+    workload.image[CPU::RES + 1] = static_cast<uint8_t>(origin >> 8);
+    return workload;
+}
+
+/**
+ * @brief Convert a number below 10^(2 * size) to packed BCD, the least significant byte first
+ */
+template <size_t size>
+[[nodiscard]] std::array<uint8_t, size> to_bcd(unsigned value) noexcept {
+    std::array<uint8_t, size> result{};
+    for (auto &byte : result) {
+        byte = static_cast<uint8_t>((value / 10 % 10) << 4 | value % 10);
+        value /= 100;
+    }
+    return result;
+}
+
+void memory(std::vector<Workload> &workloads) {
+    auto &workload = create(workloads, "memory", "memcpy and memset of pages through (zp),Y");
+    constexpr uint8_t repeats = 8;
+    constexpr uint16_t source = 0x3000, destination = 0x5000, filled = 0x6000, size = 0x1000;
+
+    std::mt19937 random{ 1 };
+    for (uint16_t i = 0; i < size; ++i) workload.image[source + i] = static_cast<uint8_t>(random());
+
+    Emitter e{ workload.image, origin };
+    e({ 0xD8 });          // CLD
+    e({ 0xA9, repeats }); // LDA #repeats
+    e({ 0x85, 0x04 });    // STA $04
+    const auto outer = e.here();
+    e({ 0xA9, 0x00 });             // LDA #0
+    e({ 0x85, 0x00 });             // STA $00
+    e({ 0x85, 0x02 });             // STA $02
+    e({ 0xA9, source >> 8 });      // LDA #>source
+    e({ 0x85, 0x01 });             // STA $01
+    e({ 0xA9, destination >> 8 }); // LDA #>destination
+    e({ 0x85, 0x03 });             // STA $03
+    e({ 0xA2, size >> 8 });        // LDX #pages
+    e({ 0xA0, 0x00 });             // LDY #0
+    const auto copy = e.here();
+    e({ 0xB1, 0x00 });        // LDA ($00),Y
+    e({ 0x91, 0x02 });        // STA ($02),Y
+    e({ 0xC8 });              // INY
+    e.branch(0xD0, copy);     // BNE copy
+    e({ 0xE6, 0x01 });        // INC $01
+    e({ 0xE6, 0x03 });        // INC $03
+    e({ 0xCA });              // DEX
+    e.branch(0xD0, copy);     // BNE copy
+    e({ 0xA9, filled >> 8 }); // LDA #>filled
+    e({ 0x85, 0x03 });        // STA $03
+    e({ 0xA9, 0xA5 });        // LDA #$A5
+    e({ 0xA2, size >> 8 });   // LDX #pages
+    const auto fill = e.here();
+    e({ 0x91, 0x02 });     // STA ($02),Y
+    e({ 0xC8 });           // INY
+    e.branch(0xD0, fill);  // BNE fill
+    e({ 0xE6, 0x03 });     // INC $03
+    e({ 0xCA });           // DEX
+    e.branch(0xD0, fill);  // BNE fill
+    e({ 0xC6, 0x04 });     // DEC $04
+    e.branch(0xD0, outer); // BNE outer
+    workload.trap = e.trap();
+
+    for (uint16_t i = 0; i < size; ++i) {
+        workload.expected.emplace_back(destination + i, workload.image[source + i]);
+        workload.expected.emplace_back(filled + i, 0xA5);
+    }
+    workload.expected.emplace_back(0x01, (source + size) >> 8);
+    workload.expected.emplace_back(0x03, (filled + size) >> 8);
+    workload.expected.emplace_back(0x04, 0);
+}
+
+void decimal(std::vector<Workload> &workloads) {
+    auto &workload = create(workloads, "decimal", "BCD counters updated by ADC and SBC in the decimal mode");
+    constexpr uint8_t outer_count = 157, inner_count = 250, step = 7;
+    workload.image[0x14] = 0x99; // the second counter counts down from 9999
+    workload.image[0x15] = 0x99;
+
+    Emitter e{ workload.image, origin };
+    e({ 0xF8 });              // SED
+    e({ 0xA0, outer_count }); // LDY #outer_count
+    const auto outer = e.here();
+    e({ 0xA2, inner_count }); // LDX #inner_count
+    const auto inner = e.here();
+    e({ 0x18 }); // CLC
+    for (uint8_t address = 0x10; address < 0x14; ++address) {
+        e({ 0xA5, address });         // LDA counter
+        e({ 0x69, address == 0x10 }); // ADC #1 for the lowest byte, ADC #0 for the carry into the others
+        e({ 0x85, address });         // STA counter
+    }
+    e({ 0x38 }); // SEC
+    for (uint8_t address = 0x14; address < 0x16; ++address) {
+        e({ 0xA5, address });                               // LDA counter
+        e({ 0xE9, address == 0x14 ? step : uint8_t{ 0 } }); // SBC #step, SBC #0 for the borrow
+        e({ 0x85, address });                               // STA counter
+    }
+    e({ 0xCA });           // DEX
+    e.branch(0xD0, inner); // BNE inner
+    e({ 0x88 });           // DEY
+    e.branch(0xD0, outer); // BNE outer
+    e({ 0xD8 });           // CLD
+    workload.trap = e.trap();
+
+    constexpr unsigned iterations = outer_count * inner_count;
+    const auto up                 = to_bcd<4>(iterations);
+    const auto down               = to_bcd<2>((9999 + 10000 - iterations * step % 10000) % 10000);
+    for (uint8_t i = 0; i < up.size(); ++i) workload.expected.emplace_back(0x10 + i, up[i]);
+    for (uint8_t i = 0; i < down.size(); ++i) workload.expected.emplace_back(0x14 + i, down[i]);
+}
+
+void sort(std::vector<Workload> &workloads) {
+    auto &workload = create(workloads, "sort", "bubble sort dominated by compares and conditional branches");
+    constexpr uint16_t array = 0x2000;
+    constexpr uint8_t size   = 200;
+
+    std::mt19937 random{ 2 };
+    std::array<uint8_t, size> values{};
+    for (auto &value : values) value = static_cast<uint8_t>(random());
+    std::ranges::copy(values, workload.image.begin() + array);
+
+    Emitter e{ workload.image, origin };
+    e({ 0xD8 });           // CLD
+    e({ 0xA9, size - 1 }); // LDA #size-1
+    e({ 0x85, 0x20 });     // STA $20, the number of pairs in the pass
+    const auto pass = e.here();
+    e({ 0xA2, 0x00 }); // LDX #0
+    const auto compare = e.here();
+    e(0xBD, array);                     // LDA array,X
+    e(0xDD, array + 1);                 // CMP array+1,X
+    const auto less  = e.forward(0x90); // BCC next
+    const auto equal = e.forward(0xF0); // BEQ next
+    e({ 0xA8 });                        // TAY
+    e(0xBD, array + 1);                 // LDA array+1,X
+    e(0x9D, array);                     // STA array,X
+    e({ 0x98 });                        // TYA
+    e(0x9D, array + 1);                 // STA array+1,X
+    e.land(less);
+    e.land(equal);
+    e({ 0xE8 });             // INX
+    e({ 0xE4, 0x20 });       // CPX $20
+    e.branch(0xD0, compare); // BNE compare
+    e({ 0xC6, 0x20 });       // DEC $20
+    e.branch(0xD0, pass);    // BNE pass
+    workload.trap = e.trap();
+
+    std::ranges::sort(values);
+    for (uint8_t i = 0; i < size; ++i) workload.expected.emplace_back(array + i, values[i]);
+    workload.expected.emplace_back(0x20, 0);
+}
+
+void list(std::vector<Workload> &workloads) {
+    auto &workload = create(workloads, "list", "walk over a shuffled linked list through (zp),Y");
+    constexpr uint16_t records = 0x4000, count = 512, record_size = 16;
+    constexpr uint8_t repeats = 4;
+
+    // The records are linked in a random order, so that the walk jumps all over the pages
+    std::mt19937 random{ 3 };
+    std::array<uint16_t, count> order{};
+    std::iota(order.begin(), order.end(), uint16_t{ 0 });
+    for (auto i = count - 1; i > 0; --i) std::swap(order[i], order[random() % (i + 1)]);
+
+    unsigned sum = 0;
+    for (uint16_t i = 0; i < count; ++i) {
+        const auto address = static_cast<uint16_t>(records + order[i] * record_size);
+        const auto next    = i + 1 < count ? static_cast<uint16_t>(records + order[i + 1] * record_size) : 0;
+        workload.image[address]     = static_cast<uint8_t>(next);
+        workload.image[address + 1] = static_cast<uint8_t>(next >> 8);
+        for (uint16_t j = 2; j < record_size; ++j) sum += workload.image[address + j] = static_cast<uint8_t>(random());
+    }
+    const auto head = static_cast<uint16_t>(records + order[0] * record_size);
+
+    Emitter e{ workload.image, origin };
+    e({ 0xD8 });          // CLD
+    e({ 0xA9, repeats }); // LDA #repeats
+    e({ 0x85, 0x34 });    // STA $34
+    const auto outer = e.here();
+    e({ 0xA9, static_cast<uint8_t>(head) });      // LDA #<head
+    e({ 0x85, 0x30 });                            // STA $30
+    e({ 0xA9, static_cast<uint8_t>(head >> 8) }); // LDA #>head
+    e({ 0x85, 0x31 });                            // STA $31
+    const auto node = e.here();
+    e({ 0xA0, 0x02 }); // LDY #2
+    const auto add = e.here();
+    e({ 0xB1, 0x30 });                     // LDA ($30),Y
+    e({ 0x18 });                           // CLC
+    e({ 0x65, 0x32 });                     // ADC $32
+    e({ 0x85, 0x32 });                     // STA $32
+    const auto no_carry = e.forward(0x90); // BCC next
+    e({ 0xE6, 0x33 });                     // INC $33
+    e.land(no_carry);
+    e({ 0xC8 });              // INY
+    e({ 0xC0, record_size }); // CPY #record_size
+    e.branch(0xD0, add);      // BNE add
+    e({ 0xA0, 0x00 });        // LDY #0
+    e({ 0xB1, 0x30 });        // LDA ($30),Y
+    e({ 0xAA });              // TAX
+    e({ 0xC8 });              // INY
+    e({ 0xB1, 0x30 });        // LDA ($30),Y
+    e({ 0x86, 0x30 });        // STX $30
+    e({ 0x85, 0x31 });        // STA $31
+    e.branch(0xD0, node);     // BNE node, the list ends with a null pointer
+    e({ 0xC6, 0x34 });        // DEC $34
+    e.branch(0xD0, outer);    // BNE outer
+    workload.trap = e.trap();
+
+    sum *= repeats;
+    workload.expected.emplace_back(0x30, 0);
+    workload.expected.emplace_back(0x31, 0);
+    workload.expected.emplace_back(0x32, static_cast<uint8_t>(sum));
+    workload.expected.emplace_back(0x33, static_cast<uint8_t>(sum >> 8));
+    workload.expected.emplace_back(0x34, 0);
+}
+
+void recursion(std::vector<Workload> &workloads) {
+    auto &workload = create(workloads, "recursion", "recursive Fibonacci numbers and deep chains of JSR and RTS");
+    constexpr uint8_t argument = 20, depth = 80, repeats = 100;
+
+    // The subroutines follow the main program on the next page
+    Emitter s{ workload.image, origin + 0x0100 };
+
+    // Adds the Fibonacci number of X to $40-$41 by summing the leaves of the recursion
+    const auto fibonacci = s.here();
+    s({ 0xE0, 0x02 });                     // CPX #2
+    const auto recurse = s.forward(0xB0);  // BCS recurse
+    s({ 0x8A });                           // TXA
+    s({ 0x18 });                           // CLC
+    s({ 0x65, 0x40 });                     // ADC $40
+    s({ 0x85, 0x40 });                     // STA $40
+    const auto no_carry = s.forward(0x90); // BCC return
+    s({ 0xE6, 0x41 });                     // INC $41
+    s.land(no_carry);
+    s({ 0x60 }); // RTS
+    s.land(recurse);
+    s({ 0xCA });        // DEX
+    s({ 0x8A });        // TXA
+    s({ 0x48 });        // PHA
+    s(0x20, fibonacci); // JSR fibonacci
+    s({ 0x68 });        // PLA
+    s({ 0xAA });        // TAX
+    s({ 0xCA });        // DEX
+    s(0x20, fibonacci); // JSR fibonacci
+    s({ 0x60 });        // RTS
+
+    // Calls itself until X reaches zero, and counts the returns in $42
+    const auto chain = s.here();
+    s({ 0xCA });                         // DEX
+    const auto bottom = s.forward(0xF0); // BEQ return
+    s({ 0x8A });                         // TXA
+    s({ 0x48 });                         // PHA
+    s(0x20, chain);                      // JSR chain
+    s({ 0x68 });                         // PLA
+    s({ 0xAA });                         // TAX
+    s({ 0xE6, 0x42 });                   // INC $42
+    s.land(bottom);
+    s({ 0x60 }); // RTS
+
+    Emitter e{ workload.image, origin };
+    e({ 0xD8 });           // CLD
+    e({ 0xA2, argument }); // LDX #argument
+    e(0x20, fibonacci);    // JSR fibonacci
+    e({ 0xA9, repeats });  // LDA #repeats
+    e({ 0x85, 0x43 });     // STA $43
+    const auto again = e.here();
+    e({ 0xA2, depth });    // LDX #depth
+    e(0x20, chain);        // JSR chain
+    e({ 0xC6, 0x43 });     // DEC $43
+    e.branch(0xD0, again); // BNE again
+    workload.trap = e.trap();
+
+    unsigned previous = 0, current = 1;
+    for (uint8_t i = 1; i < argument; ++i) current = std::exchange(previous, current) + current;
+    workload.expected.emplace_back(0x40, static_cast<uint8_t>(current));
+    workload.expected.emplace_back(0x41, static_cast<uint8_t>(current >> 8));
+    workload.expected.emplace_back(0x42, static_cast<uint8_t>((depth - 1) * repeats));
+    workload.expected.emplace_back(0x43, 0);
+}
+} // namespace
+
+std::vector<Workload> Workload::all() {
+    std::vector<Workload> workloads;
+    workloads.reserve(5); // the references returned by create stay valid
+    memory(workloads);
+    decimal(workloads);
+    sort(workloads);
+    list(workloads);
+    recursion(workloads);
+    return workloads;
+}
+
+bool Workload::verify(const Memory &memory) const noexcept {
+    return std::ranges::all_of(expected, [&memory](const auto &byte) { return memory[byte.first] == byte.second; });
+}
+} // namespace emulator::mos_6502
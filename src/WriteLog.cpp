@@ -0,0 +1,28 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+
+#include "WriteLog.hpp"
+
+#include <algorithm>
+
+namespace emulator::mos_6502 {
+WriteLog::WriteLog() : _writes(size_t{ 1 } << 16) {}
+
+std::optional<WriteLog::Write> WriteLog::last_write(const uint16_t address, const size_t cycle) const noexcept {
+    const auto &writes = _writes[address];
+    const auto after   = std::ranges::lower_bound(writes, cycle, {}, &Write::cycle);
+    if (after == writes.begin()) return std::nullopt;
+    return *std::prev(after);
+}
+
+const std::vector<WriteLog::Write> &WriteLog::writes(const uint16_t address) const noexcept {
+    return _writes[address];
+}
+
+size_t WriteLog::size() const noexcept { return _size; }
+
+size_t WriteLog::end() const noexcept { return _end; }
+
+bool WriteLog::overflowed() const noexcept { return _overflowed; }
+} // namespace emulator::mos_6502
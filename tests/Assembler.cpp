@@ -0,0 +1,135 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Assembler.hpp"
+#include "Trap.hpp"
+
+#include <algorithm>
+#include <array>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+namespace emulator::mos_6502::test {
+namespace {
+constexpr auto program = Assembler::image(R"(
+zero    = $10
+        .org $0200
+start:  LDX #5          ; the counter
+        LDA #0
+loop:   CLC
+        ADC zero
+        STA result
+        DEX
+        BNE loop
+done:   JMP done
+result: .byte 0
+        .org $FFFC
+        .word start
+)");
+
+// Assembled at compile time, with a zero-page operand and a forward label in the absolute mode
+static_assert(program[0x0200] == 0xA2 && program[0x0201] == 0x05);
+static_assert(program[0x0204] == 0x18);
+static_assert(program[0x0205] == 0x65 && program[0x0206] == 0x10);
+static_assert(program[0x0207] == 0x8D && program[0x0208] == 0x10 && program[0x0209] == 0x02);
+static_assert(program[0x020B] == 0xD0 && program[0x020C] == 0xF7);
+static_assert(program[0x020D] == 0x4C && program[0x020E] == 0x0D && program[0x020F] == 0x02);
+static_assert(program[0xFFFC] == 0x00 && program[0xFFFD] == 0x02);
+
+static_assert(Assembler::assemble("LDA #$100").error == "operand out of range");
+static_assert(Assembler::assemble("NOP\nLDA (missing),Y").line == 2);
+
+/**
+ * @brief Operand of an instruction in the given addressing mode
+ */
+[[nodiscard]] std::string operand(const Addressing addressing) {
+    switch (addressing) {
+    case Addressing::Accumulator: return "A";
+    case Addressing::Absolute: return "$1234";
+    case Addressing::AbsoluteX: return "$1234,X";
+    case Addressing::AbsoluteY: return "$1234,Y";
+    case Addressing::Implicit: return "";
+    case Addressing::Immediate: return "#$12";
+    case Addressing::Indirect: return "($1234)";
+    case Addressing::IndexedIndirect: return "($12,X)";
+    case Addressing::IndirectIndexed: return "($12),Y";
+    case Addressing::Relative: return "*+$12";
+    case Addressing::ZeroPage: return "$12";
+    case Addressing::ZeroPageX: return "$12,X";
+    case Addressing::ZeroPageY: return "$12,Y";
+    }
+    return {};
+}
+} // namespace
+
+TEST(Assembly, EncodesEveryOpcode) {
+    for (unsigned opcode = 0; opcode < 0x100; ++opcode) {
+        const auto instruction = getInstruction(static_cast<uint8_t>(opcode));
+        const auto addressing  = getAddressing(static_cast<uint8_t>(opcode));
+        if (!instruction || !addressing) continue;
+
+        const auto source = ".org $0200\n" + std::string(getMnemonic(*instruction)) + ' ' + operand(*addressing);
+        const auto result = Assembler::assemble(source);
+        ASSERT_EQ(result.error, "") << source;
+        EXPECT_EQ(getInstruction(result.image[0x0200]), instruction) << source;
+        EXPECT_EQ(getAddressing(result.image[0x0200]), addressing) << source;
+        if (addressing == Addressing::Relative) {
+            EXPECT_EQ(result.image[0x0201], 0x10) << source;
+        } else if (addressing != Addressing::Implicit && addressing != Addressing::Accumulator) {
+            EXPECT_EQ(result.image[0x0201], operand(*addressing).find("1234") == std::string::npos ? 0x12 : 0x34)
+                << source;
+        }
+    }
+}
+
+TEST(Assembly, Syntax) {
+    const auto result = Assembler::assemble(R"(
+        .org 512
+        lda   ( pointer , x )   ; spaces and lowercase
+        ldy   #>table + 1
+        ldx   #<table
+        asl
+        stx   %1111,y
+table:  .word table, * - 2
+pointer = $80
+        lda   pointer
+)");
+    ASSERT_EQ(result.error, "");
+    const std::array<uint8_t, 17> expected{ 0xA1, 0x80, 0xA0, 0x02, 0xA2, 0x09, 0x0A, 0x96, 0x0F,
+                                            0x09, 0x02, 0x09, 0x02, 0xA5, 0x80, 0x00, 0x00 };
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), result.image.begin() + 0x0200));
+}
+
+TEST(Assembly, Errors) {
+    const auto error = [](const std::string_view source) { return Assembler::assemble(source).error; };
+    EXPECT_EQ(error("FOO"), "unknown mnemonic");
+    EXPECT_EQ(error("JMP nowhere"), "undefined symbol");
+    EXPECT_EQ(error("a: NOP\na: NOP"), "duplicate symbol");
+    EXPECT_EQ(error("LDA ($10),X"), "malformed operand");
+    EXPECT_EQ(error("LDA $10,Z"), "malformed operand");
+    EXPECT_EQ(error("LDA #"), "missing operand");
+    EXPECT_EQ(error("LDA #$1G"), "malformed expression");
+    EXPECT_EQ(error("JMP #$10"), "unsupported addressing mode");
+    EXPECT_EQ(error("STX $1234,Y"), "operand out of range");
+    EXPECT_EQ(error(".org later\nlater: NOP"), "origin must be known");
+    EXPECT_EQ(error(".fill 1"), "unknown directive");
+    EXPECT_EQ(error(".byte 256"), "value out of range");
+    EXPECT_EQ(error("BNE far\n.org $0100\nfar: NOP"), "branch out of range");
+    EXPECT_EQ(error("LDA #$10000"), "number out of range");
+
+    const auto result = Assembler::assemble("NOP\n\nBNE missing ; comment");
+    EXPECT_EQ(result.error, "undefined symbol");
+    EXPECT_EQ(result.line, 3);
+}
+
+TEST(Assembly, Runs) {
+    const auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ program });
+    cpu->memory().write(0x10, 7);
+    cpu->reset();
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Loop);
+    EXPECT_EQ(trap.PC, 0x020D);
+    EXPECT_EQ(cpu->memory()[0x0210], 5 * 7);
+}
+} // namespace emulator::mos_6502::test
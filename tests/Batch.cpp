@@ -0,0 +1,73 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Batch.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Create an instance counting down from a value in X, storing the number of rounds in $10
+ *
+ * @code{asm}
+ * $0200: LDX #count
+ * $0202: DEX
+ * $0203: BNE $0202
+ * $0205: INC $10
+ * $0207: JMP $0200
+ * @endcode
+ */
+std::unique_ptr<CPU> counter(const uint8_t count) {
+    Memory::Data data{};
+    std::ranges::copy(std::initializer_list<uint8_t>{ 0xA2, count, 0xCA, 0xD0, 0xFD, 0xE6, 0x10, 0x4C, 0x00, 0x02 },
+                      data.begin() + 0x0200);
+    data[CPU::RES + 1] = 0x02;
+
+    auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    cpu->reset();
+    return cpu;
+}
+
+TEST(Batch, MatchesSequentialExecution) {
+    Batch batch(4, 1'000);
+    for (unsigned i = 0; i < 64; ++i) batch.add(counter(static_cast<uint8_t>(i + 1)), 20'000 + i * 1'000);
+    const auto results = batch.run();
+    ASSERT_EQ(results.size(), 64);
+
+    for (unsigned i = 0; i < 64; ++i) {
+        const auto reference = counter(static_cast<uint8_t>(i + 1));
+        EXPECT_TRUE(reference->run(20'000 + i * 1'000));
+
+        EXPECT_EQ(results[i].registers, reference->registers());
+        EXPECT_EQ(results[i].cycles, reference->cycle() - 7);
+        EXPECT_FALSE(results[i].stopped);
+        EXPECT_EQ(batch.instance(i).memory()[0x10], reference->memory()[0x10]);
+    }
+}
+
+TEST(Batch, StoppedInstance) {
+    Memory::Data data{};
+    data[0x0200]       = 0xEA; // NOP
+    data[0x0201]       = 0x02; // illegal
+    data[CPU::RES + 1] = 0x02;
+    auto jammed        = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    jammed->reset();
+
+    Batch batch(2, 100);
+    batch.add(counter(10), 1'000);
+    batch.add(std::move(jammed), 1'000);
+    const auto results = batch.run();
+
+    EXPECT_FALSE(results[0].stopped);
+    EXPECT_GE(results[0].cycles, 1'000);
+    EXPECT_TRUE(results[1].stopped);
+    EXPECT_EQ(results[1].cycles, 3); // NOP and the fetch of the illegal opcode
+    EXPECT_EQ(results[1].registers.PC, 0x0201);
+}
+
+TEST(Batch, Empty) {
+    Batch batch;
+    EXPECT_TRUE(batch.run().empty());
+}
+} // namespace emulator::mos_6502::test
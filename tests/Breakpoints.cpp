@@ -0,0 +1,115 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Breakpoints.hpp"
+#include "CPU.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+TEST(Breakpoints, PageFilter) {
+    Breakpoints breakpoints;
+    EXPECT_FALSE(breakpoints.watched(Access::Write, 0x1234));
+
+    breakpoints.add(Access::Write, 0x1234);
+    breakpoints.add(Access::Write, 0x12FF);
+    EXPECT_TRUE(breakpoints.watched(Access::Write, 0x1200));
+    EXPECT_FALSE(breakpoints.watched(Access::Write, 0x1300));
+    EXPECT_FALSE(breakpoints.watched(Access::Read, 0x1234));
+
+    breakpoints.remove(Access::Write, 0x1234);
+    EXPECT_TRUE(breakpoints.watched(Access::Write, 0x1200));
+    breakpoints.remove(Access::Write, 0x12FF);
+    EXPECT_FALSE(breakpoints.watched(Access::Write, 0x1200));
+}
+
+struct Debugging : testing::Test {
+    Memory::Data data{};
+
+    Breakpoints breakpoints;
+
+    std::unique_ptr<CPU> cpu;
+
+    void SetUp() override {
+        data[CPU::RES + 1] = 0x02;
+        // LDA $10; STA $11; LDA #$05; STA $11; JMP $0200
+        const uint8_t program[] = { 0xA5, 0x10, 0x85, 0x11, 0xA9, 0x05, 0x85, 0x11, 0x4C, 0x00, 0x02 };
+        std::ranges::copy(program, data.begin() + 0x0200);
+
+        cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+        cpu->set_breakpoints(&breakpoints);
+    }
+};
+
+TEST_F(Debugging, Breakpoint) {
+    breakpoints.add(Access::Execute, 0x0204);
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step());
+
+    const auto cycle = cpu->cycle();
+    EXPECT_FALSE(cpu->step());
+    EXPECT_EQ(cpu->registers().PC, 0x0204);
+    EXPECT_EQ(cpu->cycle(), cycle);
+    ASSERT_TRUE(breakpoints.hit());
+    EXPECT_EQ(breakpoints.hit()->access, Access::Execute);
+    EXPECT_EQ(breakpoints.hit()->value, 0xA9);
+
+    EXPECT_TRUE(cpu->step()); // resumed
+    EXPECT_EQ(cpu->registers().A, 0x05);
+    EXPECT_FALSE(breakpoints.hit());
+}
+
+TEST_F(Debugging, ReadWatchpoint) {
+    breakpoints.add(Access::Read, 0x0010);
+    EXPECT_FALSE(cpu->step());
+    EXPECT_EQ(cpu->registers().PC, 0x0202); // the instruction is completed
+    ASSERT_TRUE(breakpoints.hit());
+    EXPECT_EQ(breakpoints.hit()->access, Access::Read);
+    EXPECT_EQ(breakpoints.hit()->address, 0x0010);
+    EXPECT_TRUE(cpu->step());
+}
+
+TEST_F(Debugging, ConditionalWatchpoint) {
+    breakpoints.add(Access::Write, 0x0011, 0x05);
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step()); // writes zero
+    EXPECT_TRUE(cpu->step());
+    EXPECT_FALSE(cpu->step());
+    ASSERT_TRUE(breakpoints.hit());
+    EXPECT_EQ(breakpoints.hit()->value, 0x05);
+    EXPECT_EQ(cpu->memory()[0x0011], 0x05);
+}
+
+TEST_F(Debugging, InterruptAfterWatchpoint) {
+    auto registers         = cpu->registers();
+    registers.SR.interrupt = false;
+    cpu->set_registers(registers);
+    breakpoints.add(Access::Read, 0x0010);
+    breakpoints.add(Access::Write, static_cast<uint16_t>(0x0100 | registers.SP)); // the return address of the IRQ
+
+    EXPECT_FALSE(cpu->step());
+    ASSERT_TRUE(breakpoints.hit());
+    EXPECT_EQ(breakpoints.hit()->address, 0x0010);
+
+    cpu->assert_irq(0);
+    EXPECT_FALSE(cpu->step());
+    EXPECT_EQ(cpu->registers().PC, 0x0000); // the vector in the fixture
+    ASSERT_TRUE(breakpoints.hit());
+    EXPECT_EQ(breakpoints.hit()->access, Access::Write);
+    EXPECT_EQ(breakpoints.hit()->address, 0x0100 | registers.SP);
+}
+
+TEST_F(Debugging, InterruptClearsHit) {
+    auto registers         = cpu->registers();
+    registers.SR.interrupt = false;
+    cpu->set_registers(registers);
+    breakpoints.add(Access::Read, 0x0010);
+    EXPECT_FALSE(cpu->step());
+
+    cpu->assert_irq(0);
+    EXPECT_TRUE(cpu->step());
+    EXPECT_FALSE(breakpoints.hit());
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,259 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "CPU.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <memory>
+#include <thread>
+
+namespace emulator::mos_6502::test {
+struct Execution : testing::Test {
+    static constexpr uint16_t origin = 0x0200;
+
+    Memory::Data data{};
+
+    std::unique_ptr<CPU> instance;
+
+    /**
+     * @brief Place a program into the memory and make the reset vector point at it
+     */
+    void load(const std::initializer_list<uint8_t> program, const uint16_t start = origin) {
+        std::ranges::copy(program, data.begin() + start);
+        data[CPU::RES]     = static_cast<uint8_t>(start);
+        data[CPU::RES + 1] = static_cast<uint8_t>(start >> 8);
+        data[CPU::IRQ]     = 0x00;
+        data[CPU::IRQ + 1] = 0x03;
+        data[0x0300]       = 0x40; // RTI
+    }
+
+    /**
+     * @brief Create a reset CPU from the current memory contents
+     */
+    CPU &boot() {
+        instance = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        instance->reset();
+        return *instance;
+    }
+
+    /**
+     * @brief Execute a number of instructions and return the number of cycles they took
+     */
+    size_t run(const size_t instructions) const {
+        const auto start = instance->cycle();
+        for (size_t i = 0; i < instructions; ++i) EXPECT_TRUE(instance->step());
+        return instance->cycle() - start;
+    }
+};
+
+TEST_F(Execution, Reset) {
+    load({});
+    const auto &cpu       = boot();
+    const auto registers = cpu.registers();
+    EXPECT_EQ(registers.PC, origin);
+    EXPECT_EQ(registers.SP, 0xFD);
+    EXPECT_TRUE(registers.SR.interrupt);
+    EXPECT_EQ(cpu.cycle(), 7);
+}
+
+TEST_F(Execution, LoadImmediate) {
+    // LDA #$80; LDX #$00; LDY #$01
+    load({ 0xA9, 0x80, 0xA2, 0x00, 0xA0, 0x01 });
+    const auto &cpu = boot();
+    EXPECT_EQ(run(1), 2);
+    EXPECT_EQ(cpu.registers().A, 0x80);
+    EXPECT_TRUE(cpu.registers().SR.negative);
+
+    EXPECT_EQ(run(1), 2);
+    EXPECT_TRUE(cpu.registers().SR.zero);
+
+    EXPECT_EQ(run(1), 2);
+    EXPECT_EQ(cpu.registers().Y, 1);
+    EXPECT_FALSE(cpu.registers().SR.zero);
+    EXPECT_FALSE(cpu.registers().SR.negative);
+}
+
+TEST_F(Execution, AddAndStore) {
+    // CLC; LDA #$40; ADC #$02; STA $10; STA $1234
+    load({ 0x18, 0xA9, 0x40, 0x69, 0x02, 0x85, 0x10, 0x8D, 0x34, 0x12 });
+    const auto &cpu = boot();
+    EXPECT_EQ(run(3), 6);
+    EXPECT_EQ(cpu.registers().A, 0x42);
+    EXPECT_EQ(run(1), 3);
+    EXPECT_EQ(cpu.memory()[0x10], 0x42);
+    EXPECT_EQ(run(1), 4);
+    EXPECT_EQ(cpu.memory()[0x1234], 0x42);
+}
+
+TEST_F(Execution, PageCrossingPenalty) {
+    // LDX #$01; LDA $02FF,X; LDA $0200,X; STA $0200,X
+    load({ 0xA2, 0x01, 0xBD, 0xFF, 0x02, 0xBD, 0x00, 0x02, 0x9D, 0x00, 0x02 });
+    boot();
+    run(1);
+    EXPECT_EQ(run(1), 5);
+    EXPECT_EQ(run(1), 4);
+    EXPECT_EQ(run(1), 5); // stores always take the extra cycle
+}
+
+TEST_F(Execution, ReadModifyWrite) {
+    // INC $10; ASL A; DEC $10
+    load({ 0xE6, 0x10, 0x0A, 0xC6, 0x10 });
+    const auto &cpu = boot();
+    EXPECT_EQ(run(1), 5);
+    EXPECT_EQ(cpu.memory()[0x10], 1);
+    EXPECT_EQ(run(1), 2);
+    EXPECT_EQ(run(1), 5);
+    EXPECT_EQ(cpu.memory()[0x10], 0);
+    EXPECT_TRUE(cpu.registers().SR.zero);
+}
+
+TEST_F(Execution, Branches) {
+    // LDX #$03; DEX; BNE -3; BEQ +0
+    load({ 0xA2, 0x03, 0xCA, 0xD0, 0xFD, 0xF0, 0x00 });
+    const auto &cpu = boot();
+    run(1);
+    EXPECT_EQ(run(2), 5); // taken
+    EXPECT_EQ(run(2), 5); // taken
+    EXPECT_EQ(run(2), 4); // not taken
+    EXPECT_EQ(cpu.registers().X, 0);
+    EXPECT_EQ(run(1), 3); // taken within the page
+    EXPECT_EQ(cpu.registers().PC, origin + 7);
+}
+
+TEST_F(Execution, BranchAcrossPage) {
+    load({ 0x90, 0x20 }, 0x02F0); // BCC +$20
+    const auto &cpu = boot();
+    EXPECT_EQ(run(1), 4);
+    EXPECT_EQ(cpu.registers().PC, 0x0312);
+}
+
+TEST_F(Execution, Subroutine) {
+    // JSR $0206; NOP; NOP; NOP; RTS
+    load({ 0x20, 0x06, 0x02, 0xEA, 0xEA, 0xEA, 0x60 });
+    const auto &cpu = boot();
+    EXPECT_EQ(run(1), 6);
+    EXPECT_EQ(cpu.registers().PC, 0x0206);
+    EXPECT_EQ(cpu.registers().SP, 0xFB);
+    EXPECT_EQ(cpu.memory()[0x01FD], 0x02);
+    EXPECT_EQ(cpu.memory()[0x01FC], 0x02);
+
+    EXPECT_EQ(run(1), 6);
+    EXPECT_EQ(cpu.registers().PC, origin + 3);
+    EXPECT_EQ(cpu.registers().SP, 0xFD);
+}
+
+TEST_F(Execution, BreakAndReturnFromInterrupt) {
+    // SEC; BRK; <padding>; NOP
+    load({ 0x38, 0x00, 0xFF, 0xEA });
+    const auto &cpu = boot();
+    run(1);
+    EXPECT_EQ(run(1), 7);
+    EXPECT_EQ(cpu.registers().PC, 0x0300);
+    EXPECT_EQ(cpu.memory()[0x01FB], 0x35); // carry, interrupt, break and the unused bit
+
+    EXPECT_EQ(run(1), 6);
+    EXPECT_EQ(cpu.registers().PC, origin + 3);
+    EXPECT_TRUE(cpu.registers().SR.carry);
+    EXPECT_TRUE(cpu.registers().SR.interrupt);
+    EXPECT_FALSE(cpu.registers().SR.break_);
+}
+
+TEST_F(Execution, IndirectJumpPageWrap) {
+    load({ 0x6C, 0xFF, 0x02 }); // JMP ($02FF)
+    data[0x02FF]    = 0x34;
+    data[0x0300]    = 0x12; // the high byte is taken from $0200 instead, which holds the opcode
+    const auto &cpu = boot();
+    EXPECT_EQ(run(1), 5);
+    EXPECT_EQ(cpu.registers().PC, 0x6C34);
+}
+
+TEST_F(Execution, Stack) {
+    // LDA #$7F; PHA; PHP; LDA #$00; PLP; PLA
+    load({ 0xA9, 0x7F, 0x48, 0x08, 0xA9, 0x00, 0x28, 0x68 });
+    const auto &cpu = boot();
+    run(1);
+    EXPECT_EQ(run(2), 6);
+    EXPECT_EQ(cpu.registers().SP, 0xFB);
+    run(1);
+    EXPECT_EQ(run(2), 8);
+    EXPECT_EQ(cpu.registers().A, 0x7F);
+    EXPECT_EQ(cpu.registers().SP, 0xFD);
+    EXPECT_FALSE(cpu.registers().SR.zero);
+}
+
+TEST_F(Execution, Compare) {
+    // LDA #$10; CMP #$10; CMP #$20
+    load({ 0xA9, 0x10, 0xC9, 0x10, 0xC9, 0x20 });
+    const auto &cpu = boot();
+    run(2);
+    EXPECT_TRUE(cpu.registers().SR.zero);
+    EXPECT_TRUE(cpu.registers().SR.carry);
+    run(1);
+    EXPECT_FALSE(cpu.registers().SR.zero);
+    EXPECT_FALSE(cpu.registers().SR.carry);
+    EXPECT_TRUE(cpu.registers().SR.negative);
+}
+
+TEST_F(Execution, IllegalOpcodeJams) {
+    load({ 0x02 });
+    auto &cpu = boot();
+    EXPECT_FALSE(cpu.step());
+    EXPECT_FALSE(cpu.step());
+    EXPECT_EQ(cpu.registers().PC, origin);
+}
+TEST_F(Execution, MaskedInterruptRequest) {
+    // NOP; CLI; NOP; NOP
+    load({ 0xEA, 0x58, 0xEA, 0xEA });
+    auto &cpu = boot();
+    cpu.assert_irq(3);
+    EXPECT_EQ(run(1), 2); // masked since the reset
+    EXPECT_EQ(run(1), 2); // CLI
+    EXPECT_EQ(run(1), 2); // the flag is only seen after the instruction following CLI
+    EXPECT_EQ(cpu.registers().PC, origin + 3);
+
+    EXPECT_EQ(run(1), 7);
+    EXPECT_EQ(cpu.registers().PC, 0x0300);
+    EXPECT_TRUE(cpu.registers().SR.interrupt);
+    EXPECT_EQ(cpu.memory()[0x01FB], 0x20); // the break flag is not set for hardware interrupts
+
+    cpu.release_irq(3);
+    EXPECT_EQ(run(1), 6); // RTI
+    EXPECT_EQ(cpu.registers().PC, origin + 3);
+    EXPECT_EQ(run(1), 2);
+}
+
+TEST_F(Execution, SharedInterruptRequestLine) {
+    load({ 0xEA, 0xEA });
+    data[0x0300]           = 0xEA; // the handler does not return
+    auto &cpu              = boot();
+    auto registers         = cpu.registers();
+    registers.SR.interrupt = false;
+    cpu.set_registers(registers);
+
+    cpu.assert_irq(5);
+    cpu.release_irq(5);
+    EXPECT_EQ(run(1), 2);
+
+    cpu.assert_irq(0);
+    cpu.assert_irq(31);
+    cpu.release_irq(0);
+    EXPECT_EQ(run(1), 7); // the other device still asserts the line
+    EXPECT_EQ(cpu.registers().PC, 0x0300);
+}
+
+TEST_F(Execution, NonMaskableInterrupt) {
+    load({ 0xEA, 0xEA, 0xEA });
+    data[CPU::NMI]     = 0x00;
+    data[CPU::NMI + 1] = 0x04;
+    data[0x0400]       = 0x40; // RTI
+    auto &cpu          = boot();
+
+    std::jthread{ [&cpu] { cpu.trigger_nmi(); } }.join();
+    EXPECT_EQ(run(1), 7); // taken despite the interrupt-disable flag
+    EXPECT_EQ(cpu.registers().PC, 0x0400);
+    EXPECT_EQ(run(1), 6);
+    EXPECT_EQ(cpu.registers().PC, origin);
+    EXPECT_EQ(run(1), 2); // the edge is only served once
+}
+} // namespace emulator::mos_6502::test
\ No newline at end of file
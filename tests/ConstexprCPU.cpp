@@ -0,0 +1,91 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Assembler.hpp"
+#include "ConstexprCPU.hpp"
+#include "Trap.hpp"
+#include "Workload.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+namespace {
+constexpr auto squares = Assembler::image(R"(
+n       = $10
+table   = $0300
+result  = $0310
+        .org $0200
+start:  LDX #0
+next:   STX n           ; the square is the sum of n copies of n
+        LDA #0
+        LDY n
+        BEQ store
+add:    CLC
+        ADC n
+        DEY
+        BNE add
+store:  STA table,X
+        INX
+        CPX #16
+        BNE next
+        SED             ; and the decimal mode works as well
+        LDA #$45
+        CLC
+        ADC #$38
+        STA result
+        CLD
+done:   JMP done
+        .org $FFFC
+        .word start
+)");
+
+/// @brief Squares program executed by the compiler
+constexpr auto finished = [] {
+    ConstexprCPU cpu{ squares };
+    cpu.reset();
+    static_cast<void>(cpu.run(100'000));
+    return cpu;
+}();
+
+static_assert([] {
+    for (unsigned n = 0; n < 16; ++n)
+        if (finished.memory()[0x0300 + n] != n * n) return false;
+    return finished.memory()[0x0310] == 0x83;
+}());
+static_assert(finished.registers().PC == 0x0222);
+static_assert(!finished.registers().SR.decimal);
+} // namespace
+
+TEST(ConstexprExecution, MatchesCPU) {
+    const auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ squares });
+    cpu->reset();
+    const auto trap = Trap::wait(*cpu, 100'000);
+    ASSERT_EQ(trap.kind, Trap::Kind::Loop);
+
+    EXPECT_EQ(cpu->registers(), finished.registers());
+    EXPECT_EQ(cpu->cycle(), finished.cycle());
+    for (uint16_t address = 0x0300; address <= 0x0310; ++address)
+        EXPECT_EQ(cpu->memory()[address], finished.memory()[address]) << address;
+}
+
+TEST(ConstexprExecution, Workloads) {
+    for (const auto &workload : Workload::all()) {
+        const auto cpu = std::make_unique<ConstexprCPU>(workload.image);
+        cpu->reset();
+        EXPECT_TRUE(cpu->run(100'000'000)) << workload.name;
+        EXPECT_EQ(cpu->registers().PC, workload.trap) << workload.name;
+        EXPECT_TRUE(workload.verify(Memory{ cpu->memory() })) << workload.name;
+    }
+}
+
+TEST(ConstexprExecution, IllegalOpcode) {
+    Memory::Data data{};
+    data[0x0000] = 0xEA; // NOP
+    data[0x0001] = 0x02; // illegal
+    const auto cpu = std::make_unique<ConstexprCPU>(data);
+    EXPECT_FALSE(cpu->run(100));
+    EXPECT_EQ(cpu->registers().PC, 0x0001);
+    EXPECT_EQ(cpu->cycle(), 2 + 1);
+}
+} // namespace emulator::mos_6502::test
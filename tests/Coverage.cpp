@@ -0,0 +1,86 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "CPU.hpp"
+#include "Coverage.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+
+namespace emulator::mos_6502::test {
+TEST(Coverage, Mark) {
+    Coverage coverage;
+    coverage.mark(Access::Read, 0x0000);
+    coverage.mark(Access::Read, 0xFFFF);
+    coverage.mark(Access::Read, 0xFFFF);
+    coverage.mark(Access::Write, 0x1234);
+
+    EXPECT_TRUE(coverage.test(Access::Read, 0x0000));
+    EXPECT_TRUE(coverage.test(Access::Read, 0xFFFF));
+    EXPECT_FALSE(coverage.test(Access::Read, 0x1234));
+    EXPECT_TRUE(coverage.test(Access::Write, 0x1234));
+    EXPECT_EQ(coverage.count(Access::Read), 2);
+    EXPECT_EQ(coverage.count(Access::Write), 1);
+    EXPECT_EQ(coverage.count(Access::Execute), 0);
+
+    coverage.clear();
+    EXPECT_EQ(coverage.count(Access::Read), 0);
+}
+
+TEST(Coverage, Merge) {
+    Coverage first;
+    Coverage second;
+    first.mark(Access::Execute, 0x0200);
+    second.mark(Access::Execute, 0x0201);
+    second.mark(Access::Write, 0x0010);
+
+    first |= second;
+    EXPECT_TRUE(first.test(Access::Execute, 0x0200));
+    EXPECT_TRUE(first.test(Access::Execute, 0x0201));
+    EXPECT_TRUE(first.test(Access::Write, 0x0010));
+    EXPECT_EQ(second.count(Access::Execute), 1);
+}
+
+TEST(Coverage, Export) {
+    Coverage coverage;
+    for (uint16_t address = 0x0200; address < 0x0208; ++address) coverage.mark(Access::Execute, address);
+    coverage.mark(Access::Read, 0x0000);
+    coverage.mark(Access::Read, 0xFFFF);
+
+    std::ostringstream json;
+    coverage.write_json(json);
+    EXPECT_EQ(json.str(), R"({"execute": [[512, 519]], "read": [[0, 0], [65535, 65535]], "write": []})"
+                          "\n");
+
+    std::ostringstream image;
+    coverage.write_image(image);
+    const auto pixels = image.str();
+    ASSERT_EQ(pixels.size(), 15 + 3 * 0x10000);
+    EXPECT_EQ(pixels.substr(15 + 3 * 0x0200, 3), std::string("\xFF\0\0", 3));
+    EXPECT_EQ(pixels.substr(15, 3), std::string("\0\xFF\0", 3));
+}
+
+TEST(Coverage, Execution) {
+    Memory::Data data{};
+    data[CPU::RES + 1] = 0x02;
+    data[0x0200]       = 0xA5; // LDA $10
+    data[0x0201]       = 0x10;
+    data[0x0202]       = 0x85; // STA $11
+    data[0x0203]       = 0x11;
+
+    Coverage coverage;
+    const auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    cpu->reset();
+    cpu->set_coverage(&coverage);
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step());
+
+    EXPECT_EQ(coverage.count(Access::Execute), 4);
+    for (uint16_t address = 0x0200; address < 0x0204; ++address) EXPECT_TRUE(coverage.test(Access::Execute, address));
+    EXPECT_EQ(coverage.count(Access::Read), 1);
+    EXPECT_TRUE(coverage.test(Access::Read, 0x0010));
+    EXPECT_EQ(coverage.count(Access::Write), 1);
+    EXPECT_TRUE(coverage.test(Access::Write, 0x0011));
+}
+} // namespace emulator::mos_6502::test
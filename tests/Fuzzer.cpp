@@ -0,0 +1,75 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Fuzzer.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+
+namespace emulator::mos_6502::test {
+struct Fuzzing : testing::Test {
+    static constexpr uint16_t entry  = 0x0400;
+    static constexpr uint16_t buffer = 0x0300;
+
+    Memory::Data data{};
+
+    Fuzzer::Options options{ .entry = entry, .buffer = buffer, .length = 0x0010, .max_length = 16 };
+
+    void load(const std::initializer_list<uint8_t> routine) { std::ranges::copy(routine, data.begin() + entry); }
+};
+
+TEST_F(Fuzzing, FindsMagicBytes) {
+    load({
+        0xAD, 0x00, 0x03, // LDA $0300
+        0xC9, 0x46,       // CMP #'F'
+        0xD0, 0x0F,       // BNE done
+        0xAD, 0x01, 0x03, // LDA $0301
+        0xC9, 0x55,       // CMP #'U'
+        0xD0, 0x08,       // BNE done
+        0xAD, 0x02, 0x03, // LDA $0302
+        0xC9, 0x5A,       // CMP #'Z'
+        0xD0, 0x01,       // BNE done
+        0x02,             // jam
+        0x60,             // done: RTS
+    });
+    options.threads = 4;
+    options.sync    = 256;
+    Fuzzer fuzzer(Memory{ data }, options);
+
+    Fuzzer::Report report;
+    for (size_t round = 0; round < 20 && report.findings.empty(); ++round) report = fuzzer.run(50'000);
+    ASSERT_EQ(report.findings.size(), 1);
+    const auto &crash = report.findings.front();
+    EXPECT_EQ(crash.termination, Sandbox::Termination::Jammed);
+    EXPECT_EQ(crash.address, entry + 21);
+    ASSERT_GE(crash.input.size(), 3);
+    EXPECT_EQ(crash.input[0], 'F');
+    EXPECT_EQ(crash.input[1], 'U');
+    EXPECT_EQ(crash.input[2], 'Z');
+
+    // Every matched byte took a new edge on the way
+    EXPECT_GE(report.corpus, 4);
+    EXPECT_GE(report.edges, 4);
+}
+
+TEST_F(Fuzzing, Hang) {
+    load({
+        0xA5, 0x10,       // LDA $10, the length
+        0xC9, 0x03,       // CMP #3
+        0xD0, 0x03,       // BNE done
+        0x4C, 0x06, 0x04, // loop: JMP loop
+        0x60,             // done: RTS
+    });
+    options.threads       = 1;
+    options.limits.cycles = 1'000;
+    Fuzzer fuzzer(Memory{ data }, options);
+    fuzzer.add_seed(std::initializer_list<uint8_t>{ 1, 2 });
+
+    const auto report = fuzzer.run(2'000);
+    EXPECT_EQ(report.executions, 2'000);
+    ASSERT_EQ(report.findings.size(), 1);
+    EXPECT_EQ(report.findings.front().termination, Sandbox::Termination::CycleBudget);
+    EXPECT_EQ(report.findings.front().input.size(), 3);
+    EXPECT_EQ(fuzzer.corpus().front(), (std::vector<uint8_t>{ 1, 2 }));
+}
+} // namespace emulator::mos_6502::test
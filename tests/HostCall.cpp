@@ -0,0 +1,155 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Assembler.hpp"
+#include "Breakpoints.hpp"
+#include "CPU.hpp"
+#include "Coverage.hpp"
+#include "Guard.hpp"
+#include "HostCall.hpp"
+#include "Scheduler.hpp"
+#include "Trap.hpp"
+#include "WriteLog.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+namespace {
+/**
+ * @brief Multiply the bytes at $10 and $11 into the word at $12, as a software routine of the guest would
+ */
+struct Multiply final : HostCall {
+    size_t calls = 0;
+
+    size_t call(Registers &registers, Memory &memory) noexcept override {
+        ++calls;
+        const auto product = static_cast<unsigned>(memory[0x10]) * memory[0x11];
+        memory.write(0x12, static_cast<uint8_t>(product));
+        memory.write(0x13, static_cast<uint8_t>(product >> 8));
+        registers.A = static_cast<uint8_t>(product >> 8);
+        return 100;
+    }
+};
+
+/**
+ * @brief Device whose registers are never accessed by the program
+ */
+struct Port final : Device {
+    void synchronize(size_t) noexcept override {}
+
+    uint8_t read(uint16_t) noexcept override { return 0; }
+
+    void write(uint16_t, uint8_t) noexcept override {}
+};
+
+constexpr auto program = Assembler::image(R"(
+        .org $0200
+start:  LDA #200
+        STA $10
+        LDA #123
+        STA $11
+        JSR multiply
+done:   JMP done
+
+multiply:
+        .byte $02       ; the trap replaces the body of the routine
+        RTS
+        .org $FFFC
+        .word start
+)");
+} // namespace
+
+struct HostCalls : testing::Test {
+    std::unique_ptr<CPU> cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ program });
+
+    Multiply multiply;
+};
+
+TEST_F(HostCalls, ReplacesRoutine) {
+    ASSERT_TRUE(cpu->set_host_call(0x02, &multiply));
+    cpu->reset();
+    const auto trap = Trap::wait(*cpu, 1000);
+    ASSERT_EQ(trap.kind, Trap::Kind::Loop);
+    EXPECT_EQ(multiply.calls, 1);
+    EXPECT_EQ(cpu->memory()[0x12] | cpu->memory()[0x13] << 8, 200 * 123);
+    EXPECT_EQ(cpu->registers().A, 200 * 123 >> 8);
+
+    // The loads and the stores, JSR, the trap with its cost, RTS and the final JMP
+    EXPECT_EQ(trap.cycles, 2 * 2 + 2 * 3 + 6 + 1 + 100 + 6 + 3);
+}
+
+TEST_F(HostCalls, OnlyIllegalOpcodes) {
+    EXPECT_FALSE(cpu->set_host_call(0xEA, &multiply)); // NOP
+    EXPECT_TRUE(cpu->set_host_call(0xFF, &multiply));
+}
+
+TEST_F(HostCalls, Detached) {
+    ASSERT_TRUE(cpu->set_host_call(0x02, &multiply));
+    ASSERT_TRUE(cpu->set_host_call(0x02, nullptr));
+    cpu->reset();
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Stopped);
+    EXPECT_EQ(trap.PC, 0x020E);
+    EXPECT_EQ(multiply.calls, 0);
+}
+
+TEST_F(HostCalls, MarksEdge) {
+    ASSERT_TRUE(cpu->set_host_call(0x02, &multiply));
+    EdgeCoverage edges;
+    cpu->set_edge_coverage(&edges);
+    cpu->reset();
+    ASSERT_EQ(Trap::wait(*cpu, 1000).kind, Trap::Kind::Loop);
+
+    EdgeCoverage trap;
+    trap.mark(0x020E, 0x020F); // from the trap to the RTS after it
+    const auto count = edges.count();
+    edges |= trap;
+    EXPECT_EQ(edges.count(), count);
+}
+
+TEST_F(HostCalls, ObservedWrites) {
+    ASSERT_TRUE(cpu->set_host_call(0x02, &multiply));
+    const auto stops = [this] {
+        cpu->reset();
+        const auto trap = Trap::wait(*cpu, 1000);
+        return trap.kind == Trap::Kind::Stopped && trap.PC == 0x020E;
+    };
+
+    Breakpoints breakpoints;
+    breakpoints.add(Access::Execute, 0x0300);
+    cpu->set_breakpoints(&breakpoints);
+    Scheduler scheduler;
+    cpu->set_scheduler(&scheduler);
+    EXPECT_FALSE(stops()); // neither a breakpoint nor a scheduler without devices sees the writes
+    EXPECT_EQ(multiply.calls, 1);
+
+    // Everything else would miss the writes of the routine
+    breakpoints.add(Access::Write, 0x0012);
+    EXPECT_TRUE(stops());
+    cpu->set_breakpoints(nullptr);
+
+    Port port;
+    scheduler.map(port, 0xD0, 0xD0);
+    EXPECT_TRUE(stops());
+    cpu->set_scheduler(nullptr);
+
+    WriteLog write_log;
+    cpu->set_write_log(&write_log);
+    EXPECT_TRUE(stops());
+    cpu->set_write_log(nullptr);
+
+    Coverage coverage;
+    cpu->set_coverage(&coverage);
+    EXPECT_TRUE(stops());
+    cpu->set_coverage(nullptr);
+
+    Guard guard;
+    cpu->set_guard(&guard);
+    EXPECT_TRUE(stops());
+    cpu->set_guard(nullptr);
+
+    EXPECT_FALSE(stops());
+    EXPECT_EQ(multiply.calls, 2);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,177 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Journal.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <sstream>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Input port returning random values at any address of its page
+ */
+struct Port : Device {
+    std::mt19937 generator;
+
+    explicit Port(const unsigned seed) : generator(seed) {}
+
+    void synchronize(size_t) noexcept override {}
+
+    uint8_t read(uint16_t) noexcept override { return static_cast<uint8_t>(generator()); }
+
+    void write(uint16_t, uint8_t) noexcept override {}
+};
+
+/**
+ * @brief Periodic timer whose interrupt request is acknowledged by reading its register
+ */
+struct Ticker : Device {
+    CPU *cpu             = nullptr;
+    Scheduler *scheduler = nullptr;
+    size_t period        = 0;
+    size_t expiration    = Scheduler::never;
+
+    void start(const size_t cycle) {
+        expiration = cycle;
+        scheduler->schedule(*this, expiration);
+    }
+
+    void synchronize(const size_t cycle) noexcept override {
+        if (cycle < expiration) return;
+        cpu->assert_irq(1);
+        start(cycle + period);
+    }
+
+    uint8_t read(uint16_t) noexcept override {
+        cpu->release_irq(1);
+        return 0;
+    }
+
+    void write(uint16_t, uint8_t) noexcept override {}
+};
+
+struct Recording : testing::Test {
+    static constexpr size_t steps = 3'000;
+
+    std::unique_ptr<CPU> cpu;
+
+    Scheduler scheduler;
+
+    Port port{ 1 };
+
+    Ticker ticker;
+
+    Journal journal{ 500 };
+
+    void SetUp() override {
+        Memory::Data data{};
+        // CLI; loop: LDA $D000; EOR $20; STA $0300,X; INX; JMP loop
+        std::ranges::copy(std::initializer_list<uint8_t>{ 0x58, 0xAD, 0x00, 0xD0, 0x45, 0x20, 0x9D, 0x00, 0x03, 0xE8,
+                                                          0x4C, 0x01, 0x02 },
+                          data.begin() + 0x0200);
+        // INC $11; LDA $D100; RTI
+        std::ranges::copy(std::initializer_list<uint8_t>{ 0xE6, 0x11, 0xAD, 0x00, 0xD1, 0x40 }, data.begin() + 0x0280);
+        data[CPU::RES + 1] = 0x02;
+        data[CPU::IRQ]     = 0x80;
+        data[CPU::IRQ + 1] = 0x02;
+
+        cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+
+        ticker.cpu       = cpu.get();
+        ticker.scheduler = &scheduler;
+        ticker.period    = 333;
+        scheduler.map(port, 0xD0, 0xD0);
+        scheduler.map(ticker, 0xD1, 0xD1);
+        ticker.start(100);
+        cpu->set_scheduler(&scheduler);
+        cpu->set_journal(&journal);
+    }
+
+    /**
+     * @brief Record the run with some host input
+     */
+    CPU::Snapshot record() {
+        journal.record(*cpu);
+        for (size_t i = 0; i < steps; ++i) {
+            if (i % 250 == 0) journal.input(*cpu, 0x20, static_cast<uint8_t>(i));
+            EXPECT_TRUE(cpu->step());
+        }
+        journal.stop();
+        return cpu->snapshot();
+    }
+
+    /**
+     * @brief Change the devices, so that the replay can only succeed if it does not use them
+     */
+    void disturb() {
+        port              = Port(2);
+        ticker.period     = 100;
+        ticker.start(cpu->cycle() + 7);
+    }
+
+    static void expect_same(const CPU::Snapshot &actual, const CPU::Snapshot &expected) {
+        EXPECT_EQ(actual.registers, expected.registers);
+        EXPECT_EQ(actual.cycle, expected.cycle);
+        for (size_t address = 0; address < 0x10000; ++address)
+            if (actual.memory[static_cast<uint16_t>(address)] != expected.memory[static_cast<uint16_t>(address)])
+                FAIL() << "Memory differs at " << address;
+    }
+};
+
+TEST_F(Recording, Replay) {
+    const auto expected = record();
+    const auto events   = journal.events();
+    EXPECT_GT(std::ranges::count(events, Journal::Event::Kind::Interrupt, &Journal::Event::kind), 10);
+    EXPECT_EQ(std::ranges::count(events, Journal::Event::Kind::Input, &Journal::Event::kind), steps / 250);
+    EXPECT_LE(journal.stream().size(), 5 * events.size() + 2);
+    EXPECT_FALSE(journal.overflowed());
+
+    disturb();
+    journal.replay(*cpu);
+    for (size_t i = 0; i < steps; ++i) EXPECT_TRUE(cpu->step());
+    EXPECT_FALSE(journal.diverged());
+    expect_same(cpu->snapshot(), expected);
+}
+
+TEST_F(Recording, Seek) {
+    const auto end = record().cycle;
+    EXPECT_GT(journal.snapshots(), 10);
+
+    disturb();
+    const auto target = end / 3;
+    journal.replay(*cpu);
+    while (cpu->cycle() < target) EXPECT_TRUE(cpu->step());
+    const auto expected = cpu->snapshot();
+
+    EXPECT_TRUE(journal.seek(*cpu, end - 10));
+    EXPECT_TRUE(journal.seek(*cpu, target));
+    EXPECT_FALSE(journal.diverged());
+    expect_same(cpu->snapshot(), expected);
+}
+
+TEST_F(Recording, SaveAndLoad) {
+    const auto initial  = cpu->snapshot();
+    const auto expected = record();
+    std::stringstream file;
+    journal.save(file);
+
+    Journal loaded;
+    ASSERT_TRUE(loaded.load(file));
+    EXPECT_EQ(loaded.events(), journal.events());
+
+    disturb();
+    cpu->restore(initial);
+    cpu->set_journal(&loaded);
+    loaded.replay(*cpu);
+    for (size_t i = 0; i < steps; ++i) EXPECT_TRUE(cpu->step());
+    EXPECT_FALSE(loaded.diverged());
+    expect_same(cpu->snapshot(), expected);
+
+    std::stringstream truncated(file.str().substr(0, file.str().size() - 1));
+    EXPECT_FALSE(loaded.load(truncated));
+}
+} // namespace emulator::mos_6502::test
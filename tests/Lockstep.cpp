@@ -0,0 +1,99 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Lockstep.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+
+namespace emulator::mos_6502::test {
+struct Lanes : testing::Test {
+    std::vector<Memory::Data> images;
+
+    /**
+     * @brief Check that every lane ends in the same state as a CPU running the same image for the same budget
+     */
+    void expect_equivalence(const Lockstep &lockstep, const size_t cycles) const {
+        for (size_t lane = 0; lane < images.size(); ++lane) {
+            SCOPED_TRACE(lane);
+            CPU cpu(std::chrono::nanoseconds(0), Memory{ images[lane] });
+            cpu.reset();
+            const bool running = cpu.run(cycles);
+
+            EXPECT_EQ(lockstep.registers(lane), cpu.registers());
+            EXPECT_EQ(lockstep.cycle(lane), cpu.cycle());
+            EXPECT_EQ(lockstep.jammed(lane), !running);
+            for (size_t address = 0; address < images[lane].size(); ++address)
+                if (lockstep.memory(lane)[static_cast<uint16_t>(address)]
+                    != cpu.memory()[static_cast<uint16_t>(address)])
+                    FAIL() << "Memory differs at " << address;
+        }
+    }
+
+    [[nodiscard]] Lockstep create() const {
+        std::vector<Memory> memories;
+        for (const auto &image : images) memories.emplace_back(image);
+        return Lockstep(std::move(memories));
+    }
+};
+
+TEST_F(Lanes, RandomPrograms) {
+    std::mt19937 generator(6502);
+    std::vector<uint8_t> opcodes;
+    for (int opcode = 0; opcode < 256; ++opcode)
+        // The decimal mode is only covered with valid digits below, so SED, PLP and RTI are excluded
+        if (getInstruction(static_cast<uint8_t>(opcode)) && opcode != 0xF8 && opcode != 0x28 && opcode != 0x40)
+            opcodes.push_back(static_cast<uint8_t>(opcode));
+
+    // Every byte is a legal opcode, so that the programs never jam
+    std::uniform_int_distribution<size_t> pick(0, opcodes.size() - 1);
+    for (size_t lane = 0; lane < Lockstep::max_lanes; ++lane)
+        for (auto &value : images.emplace_back()) value = opcodes[pick(generator)];
+
+    auto lockstep = create();
+    lockstep.run(5'000);
+    expect_equivalence(lockstep, 5'000);
+}
+
+TEST_F(Lanes, DecimalMode) {
+    // SED; LDA $10; ADC #$19; STA $11; SBC #$05; STA $12; JAM
+    const std::initializer_list<uint8_t> program{ 0xF8, 0xA5, 0x10, 0x69, 0x19, 0x85, 0x11,
+                                                  0xE9, 0x05, 0x85, 0x12, 0x02 };
+    for (uint8_t lane = 0; lane < 10; ++lane) {
+        auto &image = images.emplace_back();
+        std::ranges::copy(program, image.begin() + 0x0200);
+        image[CPU::RES + 1] = 0x02;
+        image[0x10]         = static_cast<uint8_t>(lane * 0x11);
+    }
+    // The same program in the binary mode shares all but the first instruction with the others
+    auto &binary = images.emplace_back(images.front());
+    binary[0x0200] = 0xEA; // NOP
+    binary[0x10]   = 0x0A;
+
+    auto lockstep = create();
+    lockstep.run(100);
+    expect_equivalence(lockstep, 100);
+    EXPECT_EQ(lockstep.memory(3)[0x11], 0x52);
+    EXPECT_EQ(lockstep.memory(10)[0x11], 0x23);
+    EXPECT_EQ(lockstep.dispatches(), 8);
+}
+
+TEST_F(Lanes, Reconvergence) {
+    // LDX $10; loop: DEX; BNE loop; INC $11; JAM
+    const std::initializer_list<uint8_t> program{ 0xA6, 0x10, 0xCA, 0xD0, 0xFD, 0xE6, 0x11, 0x02 };
+    for (uint8_t lane = 0; lane < Lockstep::max_lanes; ++lane) {
+        auto &image = images.emplace_back();
+        std::ranges::copy(program, image.begin() + 0x0200);
+        image[CPU::RES + 1] = 0x02;
+        image[0x10]         = static_cast<uint8_t>(lane + 1);
+    }
+
+    auto lockstep = create();
+    lockstep.run(1'000);
+    expect_equivalence(lockstep, 1'000);
+    // The lanes run the loop together until they leave it one by one, and then execute the tail together again
+    EXPECT_EQ(lockstep.dispatches(), 1 + 2 * 32 + 2);
+    EXPECT_EQ(lockstep.instructions(), 32 * 3 + 2 * (32 * 33 / 2));
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,170 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Assembler.hpp"
+#include "CPU.hpp"
+#include "Scheduler.hpp"
+#include "Trap.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace emulator::mos_6502::test {
+namespace {
+/**
+ * @brief Device counting the writes to its page and remembering the cycles it was synchronized at
+ */
+struct Port : Device {
+    std::vector<size_t> cycles;
+
+    size_t writes = 0;
+
+    void synchronize(const size_t cycle) noexcept override { cycles.push_back(cycle); }
+
+    uint8_t read(uint16_t) noexcept override { return 0; }
+
+    void write(uint16_t, uint8_t) noexcept override { ++writes; }
+};
+} // namespace
+
+struct LoopAcceleration : testing::Test {
+    /// @brief Block loop to run
+    struct Loop {
+        bool copy        = true;
+        uint16_t source  = 0x0380;
+        uint16_t target  = 0x1000;
+        uint8_t first    = 0; ///< Initial value of Y
+        uint8_t fill     = 0xAA;
+        uint16_t address = 0x0280; ///< Where the loop is placed
+        bool rom         = false;  ///< Whether the memory above $C000 is ROM
+        Device *device   = nullptr; ///< Device mapped at a page, if any
+        uint8_t page     = 0xD0;
+        size_t event     = Scheduler::never; ///< Cycle of an event of the device
+    };
+
+    /// @brief Final state of a run
+    struct Outcome {
+        Registers registers;
+        size_t cycle        = 0;
+        uint64_t digest     = 0;
+        size_t instructions = 0;
+    };
+
+    static Memory::Data image(const Loop &loop) {
+        const auto source = "source = " + std::to_string(loop.source) + "\ntarget = " + std::to_string(loop.target)
+                          + "\nfirst = " + std::to_string(loop.first) + "\nfill = " + std::to_string(loop.fill)
+                          + "\nloop = " + std::to_string(loop.address) + R"(
+        .org $0200
+start:  LDA #<source
+        STA $20
+        LDA #>source
+        STA $21
+        LDA #<target
+        STA $22
+        LDA #>target
+        STA $23
+        LDY #first
+        LDA #fill
+        JMP loop
+        .org loop
+)" + (loop.copy ? "        LDA ($20),Y\n" : "")
+                          + R"(        STA ($22),Y
+        INY
+        BNE loop
+done:   JMP done
+        .org $FFFC
+        .word start
+)";
+        auto result = Assembler::assemble(source);
+        EXPECT_EQ(result.error, "") << result.line;
+        for (unsigned i = 0; i < 0x100; ++i) result.image[0x0380 + i] = static_cast<uint8_t>(i * 7 + 3);
+        return result.image;
+    }
+
+    static Outcome run(const Loop &loop, const bool accelerated) {
+        const auto data = image(loop);
+        Scheduler scheduler;
+        const auto cpu  = std::make_unique<CPU>(std::chrono::nanoseconds(0),
+                                               loop.rom ? Memory::AppleII(data) : Memory{ data });
+        cpu->set_loop_acceleration(accelerated);
+        cpu->reset();
+        if (loop.device) {
+            scheduler.map(*loop.device, loop.page, loop.page);
+            scheduler.schedule(*loop.device, loop.event);
+            cpu->set_scheduler(&scheduler);
+        }
+        const auto trap = Trap::wait(*cpu, 100'000);
+        EXPECT_EQ(trap.kind, Trap::Kind::Loop);
+        return { .registers    = cpu->registers(),
+                 .cycle        = cpu->cycle(),
+                 .digest       = cpu->memory().digest(),
+                 .instructions = trap.instructions };
+    }
+
+    /**
+     * @brief Check that the accelerated loop ends in the same state at the same cycle
+     *
+     * @return Whether the loop was accelerated
+     */
+    static bool same(const Loop &loop) {
+        const auto plain       = run(loop, false);
+        const auto accelerated = run(loop, true);
+        EXPECT_EQ(plain.registers, accelerated.registers);
+        EXPECT_EQ(plain.cycle, accelerated.cycle);
+        EXPECT_EQ(plain.digest, accelerated.digest);
+        return accelerated.instructions < plain.instructions;
+    }
+};
+
+TEST_F(LoopAcceleration, Copy) { EXPECT_TRUE(same({})); }
+
+TEST_F(LoopAcceleration, CopyAcrossPages) {
+    EXPECT_TRUE(same({ .source = 0x0390, .target = 0x10F0, .first = 0x20, .address = 0x02FA }));
+}
+
+TEST_F(LoopAcceleration, Fill) { EXPECT_TRUE(same({ .copy = false, .target = 0x40C0, .first = 0x10 })); }
+
+TEST_F(LoopAcceleration, OverlappingCopy) { EXPECT_TRUE(same({ .source = 0x0380, .target = 0x0381 })); }
+
+TEST_F(LoopAcceleration, ReadOnlyTarget) { EXPECT_TRUE(same({ .target = 0xC080, .rom = true })); }
+
+TEST_F(LoopAcceleration, OverwrittenPointer) {
+    // The last byte written is the high byte of the pointer at $22, and the fill keeps its low byte
+    EXPECT_FALSE(same({ .copy = false, .target = 0xFF24, .fill = 0x24 }));
+}
+
+TEST_F(LoopAcceleration, OverwrittenCode) {
+    // The last byte written is the last byte of the loop
+    EXPECT_FALSE(same({ .source = 0x0200, .target = 0x0200, .address = 0x02F9 }));
+}
+
+TEST_F(LoopAcceleration, InputOutputTarget) {
+    Port port;
+    EXPECT_FALSE(same({ .target = 0xD000, .device = &port }));
+    EXPECT_EQ(port.writes, 2 * 0x100);
+}
+
+TEST_F(LoopAcceleration, DueEvent) {
+    Port port;
+    EXPECT_TRUE(same({ .device = &port, .event = 100 })); // only the rest of the loop after the event is accelerated
+    ASSERT_EQ(port.cycles.size(), 2);
+    EXPECT_EQ(port.cycles[0], port.cycles[1]);
+}
+
+TEST_F(LoopAcceleration, Budget) {
+    constexpr size_t budget = 50;
+    const auto plain        = run({}, false);
+    const auto cpu          = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ image({}) });
+    cpu->set_loop_acceleration(true);
+    cpu->reset();
+    while (cpu->cycle() < plain.cycle) {
+        const auto start = cpu->cycle();
+        ASSERT_TRUE(cpu->run(budget));
+        EXPECT_LE(cpu->cycle() - start, budget + 7); // the loop is too long to be run at once
+    }
+    EXPECT_EQ(cpu->registers(), plain.registers);
+    EXPECT_EQ(cpu->memory().digest(), plain.digest);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,91 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "CPU.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+
+namespace emulator::mos_6502::test {
+TEST(Digest, FollowsContents) {
+    Memory::Data data{};
+    data[0x1234] = 0x56;
+    Memory zeros;
+    const Memory loaded{ data };
+    EXPECT_NE(zeros.digest(), loaded.digest());
+
+    const auto initial = zeros.digest();
+    zeros.write(0x1234, 0x56);
+    EXPECT_EQ(zeros.digest(), loaded.digest());
+    for (unsigned page = 0; page < 256; ++page)
+        EXPECT_EQ(zeros.page_digest(static_cast<uint8_t>(page)), loaded.page_digest(static_cast<uint8_t>(page)));
+
+    zeros.write(0x1234, 0x00);
+    EXPECT_EQ(zeros.digest(), initial);
+    EXPECT_EQ(Memory{}.digest(), initial);
+}
+
+TEST(Digest, SingleByteChangesSinglePage) {
+    std::mt19937 generator(3);
+    Memory::Data data;
+    for (auto &byte : data) byte = static_cast<uint8_t>(generator());
+    const Memory original{ data };
+    Memory changed = original;
+    EXPECT_EQ(changed.digest(), original.digest());
+
+    changed.write(0x0342, static_cast<uint8_t>(original[0x0342] ^ 0x01));
+    EXPECT_NE(changed.digest(), original.digest());
+    for (unsigned page = 0; page < 256; ++page)
+        EXPECT_EQ(changed.page_digest(static_cast<uint8_t>(page)) == original.page_digest(static_cast<uint8_t>(page)),
+                  page != 0x03);
+
+    // Swapping two bytes is a different state
+    Memory swapped = original;
+    swapped.write(0x0500, original[0x0501]);
+    swapped.write(0x0501, original[0x0500]);
+    ASSERT_NE(original[0x0500], original[0x0501]);
+    EXPECT_NE(swapped.digest(), original.digest());
+
+    // The writes ignored by the ROM do not change the digest
+    Memory rom = original;
+    EXPECT_FALSE(rom.write(CPU::RES, static_cast<uint8_t>(original[CPU::RES] + 1)));
+    EXPECT_EQ(rom.digest(), original.digest());
+}
+
+TEST(Digest, Restore) {
+    std::mt19937 generator(5);
+    Memory::Data data;
+    for (auto &byte : data) byte = static_cast<uint8_t>(generator());
+    const Memory image{ data };
+    Memory memory{ image };
+
+    for (size_t i = 0; i < 1'000; ++i)
+        memory.write(static_cast<uint16_t>(generator() % 0xFF00), static_cast<uint8_t>(generator()));
+    EXPECT_NE(memory.digest(), image.digest());
+    memory.restore(image);
+    EXPECT_EQ(memory.digest(), image.digest());
+}
+
+TEST(Digest, CPU) {
+    Memory::Data data{};
+    data[0x0200]       = 0xE8; // INX
+    data[0x0201]       = 0xCA; // DEX
+    data[CPU::RES + 1] = 0x02;
+    auto first         = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    auto second        = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    first->reset();
+    second->reset();
+    EXPECT_EQ(first->digest(), second->digest());
+
+    ASSERT_TRUE(first->step());
+    EXPECT_NE(first->digest(), second->digest());
+    ASSERT_TRUE(first->step());
+    // INX and DEX leave X as it was, only the program counter and the flags differ
+    auto registers = second->registers();
+    registers.PC   = first->registers().PC;
+    registers.SR   = first->registers().SR;
+    second->set_registers(registers);
+    EXPECT_EQ(first->digest(), second->digest());
+}
+} // namespace emulator::mos_6502::test
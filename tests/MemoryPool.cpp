@@ -0,0 +1,71 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "MemoryPool.hpp"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace emulator::mos_6502::test {
+TEST(MemoryPool, RecyclesBlocks) {
+    auto &pool        = MemoryPool::instance();
+    auto *const block = pool.acquire(false);
+    (*block)[0x1234]  = 0xAB;
+    pool.release(block);
+
+    const auto arenas = pool.arenas();
+    EXPECT_EQ(pool.acquire(true), block); // the most recently released block is reused
+    EXPECT_TRUE(std::ranges::all_of(*block, [](const uint8_t value) { return value == 0; }));
+    EXPECT_EQ(pool.arenas(), arenas);
+    pool.release(block);
+}
+
+TEST(MemoryPool, Arenas) {
+    auto &pool = MemoryPool::instance();
+    std::vector<Memory> memories;
+    const auto count = 3 * MemoryPool::blocks_per_arena;
+    memories.reserve(count);
+    for (size_t i = 0; i < count; ++i) memories.emplace_back();
+    EXPECT_GE(pool.arenas(), 3);
+    EXPECT_LE(pool.huge_arenas(), pool.arenas());
+
+    const auto available = pool.available();
+    memories.clear();
+    EXPECT_EQ(pool.available(), available + count);
+}
+
+TEST(MemoryPool, IndependentCopies) {
+    Memory::Data data{};
+    data[0x0300] = 1;
+    const Memory original(data, { 0xC000 });
+    Memory copy(original);
+    EXPECT_TRUE(copy.write(0x0300, 2));
+    EXPECT_FALSE(copy.write(0xC000, 2)); // the partition is copied as well
+    EXPECT_EQ(original[0x0300], 1);
+    EXPECT_EQ(copy[0x0300], 2);
+
+    const Memory moved(std::move(copy));
+    EXPECT_EQ(moved[0x0300], 2);
+    EXPECT_EQ(Memory{}[0x0300], 0);
+}
+
+TEST(MemoryPool, MovedFrom) {
+    Memory::Data data{};
+    data[0x0300] = 1;
+    const Memory original(data);
+
+    Memory memory(original);
+    const Memory moved(std::move(memory));
+    memory = original; // a moved-from memory takes a new block when assigned to
+    EXPECT_TRUE(memory.write(0x0300, 2));
+    EXPECT_EQ(memory[0x0300], 2);
+    EXPECT_EQ(moved[0x0300], 1);
+    EXPECT_EQ(memory.digest(), Memory(memory).digest());
+
+    Memory other(std::move(memory));
+    memory = Memory(data); // and it can be moved to as well
+    EXPECT_EQ(memory.digest(), original.digest());
+    EXPECT_EQ(other[0x0300], 2);
+}
+} // namespace emulator::mos_6502::test
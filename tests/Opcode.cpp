@@ -16,6 +16,13 @@ TEST_P(Opcode, Decoding) {
     EXPECT_EQ(getAddressing(opcode), addressing);
 }
 
+TEST(Mnemonic, FollowsEnumeration) {
+    EXPECT_EQ(getMnemonic(Instruction::ADC), "ADC");
+    EXPECT_EQ(getMnemonic(Instruction::JSR), "JSR");
+    EXPECT_EQ(getMnemonic(Instruction::NOP), "NOP");
+    EXPECT_EQ(getMnemonic(Instruction::TYA), "TYA");
+}
+
 INSTANTIATE_TEST_SUITE_P(Valid,
                          Opcode,
                          ::testing::Values(TestParameters{ 0x69, Instruction::ADC, Addressing::Immediate },
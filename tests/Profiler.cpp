@@ -0,0 +1,85 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "CPU.hpp"
+#include "Profiler.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <sstream>
+
+namespace emulator::mos_6502::test {
+struct Profiling : testing::Test {
+    Memory::Data data{};
+
+    Profiler profiler;
+
+    /**
+     * @brief Place a piece of code at a given address
+     */
+    void place(const uint16_t address, const std::initializer_list<uint8_t> code) {
+        std::ranges::copy(code, data.begin() + address);
+    }
+
+    /**
+     * @brief Execute a number of instructions starting at $0200 with the profiler attached
+     */
+    void run(const size_t instructions) {
+        data[CPU::RES]     = 0x00;
+        data[CPU::RES + 1] = 0x02;
+
+        CPU cpu{ std::chrono::nanoseconds(0), Memory{ data } };
+        cpu.reset();
+        cpu.set_profiler(&profiler);
+        for (size_t i = 0; i < instructions; ++i) ASSERT_TRUE(cpu.step());
+    }
+};
+
+TEST_F(Profiling, NestedCalls) {
+    place(0x0200, { 0x20, 0x10, 0x02, 0x20, 0x10, 0x02, 0x4C, 0x06, 0x02 }); // JSR $0210; JSR $0210; JMP $0206
+    place(0x0210, { 0x20, 0x20, 0x02, 0x60 });                               // JSR $0220; RTS
+    place(0x0220, { 0xEA, 0x60 });                                           // NOP; RTS
+    run(11);
+
+    EXPECT_EQ(profiler.at(0x0210).hits, 2);
+    EXPECT_EQ(profiler.at(0x0210).cycles, 12);
+    EXPECT_EQ(profiler.at(0x0206).hits, 1);
+    EXPECT_EQ(profiler.at(0x0300).hits, 0);
+    EXPECT_FALSE(profiler.overflowed());
+
+    const auto histogram = profiler.instructions();
+    EXPECT_EQ(histogram[static_cast<size_t>(Instruction::JSR)].hits, 4);
+    EXPECT_EQ(histogram[static_cast<size_t>(Instruction::JSR)].cycles, 24);
+    EXPECT_EQ(histogram[static_cast<size_t>(Instruction::NOP)].cycles, 4);
+    EXPECT_EQ(histogram[static_cast<size_t>(Instruction::JMP)].hits, 1);
+
+    std::ostringstream stacks;
+    profiler.write_collapsed_stacks(stacks);
+    EXPECT_EQ(stacks.str(), "root 15\nroot;0210 24\nroot;0210;0220 16\n");
+
+    std::ostringstream instructions;
+    profiler.write_instruction_histogram(instructions);
+    EXPECT_EQ(instructions.str(), "JMP 1 3\nJSR 4 24\nNOP 2 4\nRTS 4 24\n");
+}
+
+TEST_F(Profiling, DiscardedReturnAddress) {
+    place(0x0200, { 0x20, 0x10, 0x02 });             // JSR $0210
+    place(0x0210, { 0x68, 0x68, 0x4C, 0x00, 0x02 }); // PLA; PLA; JMP $0200
+    run(8);
+
+    std::ostringstream stacks;
+    profiler.write_collapsed_stacks(stacks);
+    EXPECT_EQ(stacks.str(), "root 12\nroot;0210 22\n");
+}
+
+TEST_F(Profiling, Clear) {
+    place(0x0200, { 0xEA });
+    run(1);
+    profiler.clear();
+    EXPECT_EQ(profiler.at(0x0200).hits, 0);
+
+    std::ostringstream stacks;
+    profiler.write_collapsed_stacks(stacks);
+    EXPECT_EQ(stacks.str(), "");
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,126 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Rewind.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace emulator::mos_6502::test {
+struct History : testing::Test {
+    static constexpr size_t interval = 1'000;
+
+    std::unique_ptr<CPU> cpu;
+
+    void SetUp() override {
+        Memory::Data data{};
+        // INC $10; LDX $10; TXA; STA $0400,X; INC $0500,X; JMP $0200
+        std::ranges::copy(std::initializer_list<uint8_t>{ 0xE6, 0x10, 0xA6, 0x10, 0x8A, 0x9D, 0x00, 0x04, 0xFE, 0x00,
+                                                          0x05, 0x4C, 0x00, 0x02 },
+                          data.begin() + 0x0200);
+        data[CPU::RES + 1] = 0x02;
+        cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+    }
+
+    /**
+     * @brief Run with the history, keeping every captured state in full for comparison
+     */
+    std::vector<CPU::Snapshot> run(Rewind &rewind, const size_t captures) const {
+        std::vector<CPU::Snapshot> states;
+        for (size_t i = 0; i < captures; ++i) {
+            rewind.capture(*cpu);
+            states.push_back(cpu->snapshot());
+            const auto end = cpu->cycle() + interval;
+            while (cpu->cycle() < end) EXPECT_TRUE(cpu->step());
+        }
+        return states;
+    }
+
+    void expect_state(const CPU::Snapshot &expected) const {
+        EXPECT_EQ(cpu->registers(), expected.registers);
+        EXPECT_EQ(cpu->cycle(), expected.cycle);
+        EXPECT_EQ(cpu->irq_masked(), expected.irq_masked);
+        for (size_t address = 0; address < 0x10000; ++address)
+            if (cpu->memory()[static_cast<uint16_t>(address)] != expected.memory[static_cast<uint16_t>(address)])
+                FAIL() << "Memory differs at " << address;
+    }
+};
+
+TEST_F(History, RewindAndContinue) {
+    Rewind rewind(interval, 1 << 20);
+    const auto states = run(rewind, 50);
+    EXPECT_EQ(rewind.size(), 50);
+    // The loop changes a few bytes of three pages per iteration
+    EXPECT_LT(rewind.bytes(), 50 * 3 * 256 / 2);
+
+    ASSERT_TRUE(rewind.rewind(*cpu, interval / 2));
+    expect_state(states[49]);
+
+    ASSERT_TRUE(rewind.rewind(*cpu, 10 * interval));
+    expect_state(states[39]);
+    EXPECT_EQ(rewind.size(), 40);
+
+    // The history continues from the restored state
+    const auto next = run(rewind, 5);
+    ASSERT_TRUE(rewind.rewind(*cpu, 3 * interval + 1));
+    expect_state(next[1]);
+
+    ASSERT_TRUE(rewind.rewind(*cpu, cpu->cycle() - rewind.oldest()));
+    expect_state(states[0]);
+    EXPECT_FALSE(rewind.rewind(*cpu, 1));
+    expect_state(states[0]);
+}
+
+TEST_F(History, BoundedCapacity) {
+    Rewind rewind(interval, 4'096);
+    const auto states = run(rewind, 200);
+    EXPECT_LE(rewind.bytes(), 4'096);
+    EXPECT_LT(rewind.size(), 200);
+    EXPECT_GT(rewind.oldest(), states.front().cycle);
+
+    const auto back   = cpu->cycle() - rewind.oldest();
+    const auto oldest = states.size() - rewind.size();
+    EXPECT_FALSE(rewind.rewind(*cpu, back + 1));
+    ASSERT_TRUE(rewind.rewind(*cpu, back));
+    expect_state(states[oldest]);
+    EXPECT_EQ(rewind.size(), 1);
+}
+
+TEST_F(History, Run) {
+    Rewind rewind(interval, 1 << 20);
+    EXPECT_TRUE(rewind.run(*cpu, 20 * interval));
+    EXPECT_GE(rewind.size(), 20);
+
+    const auto registers = cpu->registers();
+    const auto cycle     = cpu->cycle();
+    ASSERT_TRUE(rewind.rewind(*cpu, 5 * interval));
+    EXPECT_LE(cpu->cycle(), cycle - 5 * interval);
+    EXPECT_TRUE(rewind.run(*cpu, cycle - cpu->cycle()));
+    EXPECT_EQ(cpu->registers(), registers); // the program is deterministic
+    EXPECT_EQ(cpu->cycle(), cycle);
+}
+
+TEST_F(History, RestoredMemory) {
+    const auto image = cpu->snapshot();
+    Rewind rewind(interval, 1 << 20);
+    static_cast<void>(run(rewind, 3));
+    rewind.capture(*cpu);
+
+    // Like Sandbox::reset, only the written pages are copied back
+    cpu->memory().restore(image.memory);
+    rewind.capture(*cpu);
+    const auto reset = cpu->snapshot();
+    ASSERT_TRUE(rewind.rewind(*cpu, 0));
+    expect_state(reset);
+
+    static_cast<void>(run(rewind, 3));
+    rewind.capture(*cpu);
+    cpu->restore(image);
+    rewind.capture(*cpu);
+    ASSERT_TRUE(rewind.rewind(*cpu, 0));
+    expect_state(image);
+}
+} // namespace emulator::mos_6502::test
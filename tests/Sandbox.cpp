@@ -0,0 +1,112 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Sandbox.hpp"
+
+#include <array>
+#include <gtest/gtest.h>
+
+namespace emulator::mos_6502::test {
+struct Sandboxing : testing::Test {
+    static constexpr uint16_t entry = 0x0200;
+
+    Memory::Data data{};
+
+    Sandbox sandbox{ Memory{ data } };
+
+    void SetUp() override {
+        // Code on page 2, read-only data on page 3, everything else but the zero page, the stack
+        // and the page of the exit address is forbidden
+        sandbox.permit(0x00, 0xFF, {});
+        sandbox.permit(0x00, 0x01, { Access::Read, Access::Write });
+        sandbox.permit(0x02, 0x02, { Access::Execute, Access::Read });
+        sandbox.permit(0x03, 0x03, { Access::Read });
+        sandbox.permit(0xFF, 0xFF, { Access::Read });
+    }
+
+    Sandbox::Outcome call(const std::initializer_list<uint8_t> program, const Sandbox::Limits &limits = {}) {
+        sandbox.reset();
+        sandbox.load(entry, program);
+        return sandbox.call(entry, limits);
+    }
+};
+
+TEST_F(Sandboxing, Returned) {
+    // LDA #$2A; STA $10; RTS
+    const auto outcome = call({ 0xA9, 0x2A, 0x85, 0x10, 0x60 });
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::Returned);
+    EXPECT_EQ(outcome.registers.PC, Sandbox::default_exit);
+    EXPECT_EQ(outcome.cycles, 2 + 3 + 6);
+    EXPECT_EQ(outcome.writes, 1);
+    EXPECT_FALSE(outcome.violation);
+    EXPECT_EQ(sandbox.memory()[0x10], 0x2A);
+
+    // The next program starts from the image again
+    EXPECT_EQ(call({ 0xA5, 0x10, 0x60 }).registers.A, 0); // LDA $10; RTS
+    EXPECT_EQ(sandbox.memory()[0x10], 0);
+}
+
+TEST_F(Sandboxing, CycleBudget) {
+    const auto outcome = call({ 0x4C, 0x00, 0x02 }, { .cycles = 100 }); // JMP $0200
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::CycleBudget);
+    EXPECT_EQ(outcome.cycles, 102);
+}
+
+TEST_F(Sandboxing, WriteBudget) {
+    // PHA; JMP $0200
+    const auto outcome = call({ 0x48, 0x4C, 0x00, 0x02 }, { .writes = 5 });
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::WriteBudget);
+    EXPECT_EQ(outcome.writes, 5);
+    EXPECT_EQ(outcome.violation->address, 0x01F8);
+    EXPECT_EQ(outcome.registers.SP, 0xF7);
+}
+
+TEST_F(Sandboxing, ReadOnlyRegion) {
+    // LDA $0300; STA $0301
+    const auto outcome = call({ 0xAD, 0x00, 0x03, 0x8D, 0x01, 0x03 });
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::AccessViolation);
+    EXPECT_EQ(outcome.violation->kind, Guard::Violation::Kind::Permission);
+    EXPECT_EQ(outcome.violation->access, Access::Write);
+    EXPECT_EQ(outcome.violation->address, 0x0301);
+    EXPECT_EQ(outcome.writes, 0);
+}
+
+TEST_F(Sandboxing, NonExecutableRegion) {
+    const auto outcome = call({ 0x4C, 0x00, 0x03 }); // JMP $0300
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::AccessViolation);
+    EXPECT_EQ(outcome.violation->access, Access::Execute);
+    EXPECT_EQ(outcome.registers.PC, 0x0300);
+}
+
+TEST_F(Sandboxing, Jammed) {
+    const auto outcome = call({ 0xEA, 0x02 });
+    EXPECT_EQ(outcome.termination, Sandbox::Termination::Jammed);
+    EXPECT_EQ(outcome.registers.PC, entry + 1);
+}
+
+TEST_F(Sandboxing, Deterministic) {
+    // LDX #$00; loop: INX; STX $10; BNE loop; RTS
+    const std::initializer_list<uint8_t> program{ 0xA2, 0x00, 0xE8, 0x86, 0x10, 0xD0, 0xFB, 0x60 };
+    const auto first  = call(program, { .cycles = 777 });
+    const auto second = call(program, { .cycles = 777 });
+    EXPECT_EQ(first.termination, second.termination);
+    EXPECT_EQ(first.registers, second.registers);
+    EXPECT_EQ(first.cycles, second.cycles);
+    EXPECT_EQ(first.writes, second.writes);
+}
+
+TEST(Memory, RestoreDirtyPages) {
+    Memory::Data data{};
+    data[0x1234] = 7;
+    const Memory image(data);
+    Memory memory(image);
+    memory.write(0x1234, 1);
+    memory.write(0x0010, 2);
+    memory.write(0xFFFC, 3); // ROM
+
+    memory.restore(image);
+    EXPECT_EQ(memory[0x1234], 7);
+    EXPECT_EQ(memory[0x0010], 0);
+    EXPECT_EQ(memory[0xFFFC], 0);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,167 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "CPU.hpp"
+#include "Scheduler.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Device remembering the cycles it was synchronized at
+ */
+struct Recorder : Device {
+    std::vector<size_t> cycles;
+
+    uint8_t last_written = 0;
+
+    void synchronize(const size_t cycle) noexcept override { cycles.push_back(cycle); }
+
+    uint8_t read(const uint16_t address) noexcept override { return static_cast<uint8_t>(address); }
+
+    void write(uint16_t, const uint8_t value) noexcept override { last_written = value; }
+};
+
+/**
+ * @brief Timer raising an interrupt request when a period elapses
+ *
+ * Its only register at any address of its page reads the number of cycles left until the interrupt.
+ * Writing a value restarts the timer with that period.
+ */
+struct Timer : Device {
+    CPU *cpu             = nullptr;
+    Scheduler *scheduler = nullptr;
+
+    size_t expiration = Scheduler::never;
+
+    size_t now = 0;
+
+    void synchronize(const size_t cycle) noexcept override {
+        now = cycle;
+        if (now >= expiration) {
+            cpu->assert_irq(0);
+            expiration = Scheduler::never;
+        }
+    }
+
+    uint8_t read(uint16_t) noexcept override { return static_cast<uint8_t>(expiration - now); }
+
+    void write(uint16_t, const uint8_t value) noexcept override {
+        expiration = now + value;
+        scheduler->schedule(*this, expiration);
+    }
+};
+
+TEST(Scheduler, Order) {
+    Scheduler scheduler;
+    Recorder first;
+    Recorder second;
+    EXPECT_EQ(scheduler.deadline(), Scheduler::never);
+    EXPECT_FALSE(scheduler.schedule(first, 100)); // the device is not known yet
+    EXPECT_EQ(scheduler.deadline(), Scheduler::never);
+
+    scheduler.add(first);
+    scheduler.add(second);
+    EXPECT_TRUE(scheduler.schedule(first, 100));
+    EXPECT_TRUE(scheduler.schedule(second, 50));
+    EXPECT_EQ(scheduler.deadline(), 50);
+
+    scheduler.schedule(second, 150); // replaces the previous event
+    EXPECT_EQ(scheduler.deadline(), 100);
+
+    scheduler.dispatch(120);
+    EXPECT_EQ(first.cycles, std::vector<size_t>{ 120 });
+    EXPECT_TRUE(second.cycles.empty());
+    EXPECT_EQ(scheduler.deadline(), 150);
+
+    scheduler.cancel(second);
+    EXPECT_EQ(scheduler.deadline(), Scheduler::never);
+    scheduler.dispatch(1000);
+    EXPECT_TRUE(second.cycles.empty());
+}
+
+TEST(Scheduler, Reschedule) {
+    Scheduler scheduler;
+    std::vector<Recorder> devices(5);
+    for (auto &device : devices) scheduler.add(device);
+    for (size_t i = 0; i < devices.size(); ++i) scheduler.schedule(devices[i], 1000 + i);
+
+    // A device moving its event earlier and later again keeps a single event
+    for (size_t cycle = 999; cycle > 0; --cycle) {
+        scheduler.schedule(devices[3], cycle);
+        EXPECT_EQ(scheduler.deadline(), cycle);
+        scheduler.schedule(devices[3], 2000);
+        EXPECT_EQ(scheduler.deadline(), 1000);
+    }
+    scheduler.cancel(devices[0]);
+    EXPECT_EQ(scheduler.deadline(), 1001);
+
+    scheduler.dispatch(5000);
+    for (size_t i = 0; i < devices.size(); ++i)
+        EXPECT_EQ(devices[i].cycles, i == 0 ? std::vector<size_t>{} : std::vector<size_t>{ 5000 });
+    EXPECT_EQ(scheduler.deadline(), Scheduler::never);
+}
+
+struct Devices : testing::Test {
+    Memory::Data data{};
+
+    Scheduler scheduler;
+
+    std::unique_ptr<CPU> cpu;
+
+    void boot(const std::initializer_list<uint8_t> program) {
+        data[CPU::RES + 1] = 0x02;
+        data[CPU::IRQ + 1] = 0x03;
+        std::ranges::copy(program, data.begin() + 0x0200);
+
+        cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+        cpu->set_scheduler(&scheduler);
+    }
+};
+
+TEST_F(Devices, InputOutputPage) {
+    Recorder recorder;
+    scheduler.map(recorder, 0xD0, 0xD0);
+    boot({ 0xAD, 0x42, 0xD0, 0x8D, 0x00, 0xD0, 0x8D, 0x00, 0xD1 }); // LDA $D042; STA $D000; STA $D100
+
+    EXPECT_TRUE(cpu->step());
+    EXPECT_EQ(cpu->registers().A, 0x42);
+    EXPECT_EQ(recorder.cycles, std::vector<size_t>{ 11 }); // the last cycle of the instruction
+
+    EXPECT_TRUE(cpu->step());
+    EXPECT_EQ(recorder.last_written, 0x42);
+    EXPECT_EQ(cpu->memory()[0xD000], 0x00);
+
+    EXPECT_TRUE(cpu->step());
+    EXPECT_EQ(recorder.cycles.size(), 2);
+    EXPECT_EQ(cpu->memory()[0xD100], 0x42);
+}
+
+TEST_F(Devices, TimerInterrupt) {
+    Timer timer;
+    scheduler.map(timer, 0xD0, 0xD0);
+    // CLI; LDA #$0A; STA $D000; NOP; LDA $D000; JMP $020A
+    boot({ 0x58, 0xA9, 0x0A, 0x8D, 0x00, 0xD0, 0xEA, 0xAD, 0x00, 0xD0, 0x4C, 0x0A, 0x02 });
+    timer.cpu       = cpu.get();
+    timer.scheduler = &scheduler;
+
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step());
+    EXPECT_EQ(scheduler.deadline(), 25); // written at cycle 15
+    EXPECT_TRUE(cpu->step());
+    EXPECT_TRUE(cpu->step());
+    EXPECT_EQ(cpu->registers().A, 4); // read at cycle 21
+
+    EXPECT_TRUE(cpu->step()); // JMP ends at cycle 24
+    EXPECT_EQ(cpu->registers().PC, 0x020A);
+    EXPECT_TRUE(cpu->step()); // the JMP to itself passes the deadline
+    EXPECT_EQ(cpu->registers().PC, 0x020A);
+    EXPECT_TRUE(cpu->step()); // the interrupt is taken at the next boundary
+    EXPECT_EQ(cpu->registers().PC, 0x0300);
+    EXPECT_EQ(scheduler.deadline(), Scheduler::never);
+}
+} // namespace emulator::mos_6502::test
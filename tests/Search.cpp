@@ -0,0 +1,134 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Search.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <memory>
+#include <numeric>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Combination lock advancing its stage on every correct input and resetting on a wrong one
+ */
+struct Lock : Objective {
+    static constexpr uint16_t stage  = 0x10;
+    static constexpr uint16_t input  = 0xF0;
+    static constexpr uint16_t secret = 0x0300;
+
+    uint8_t target;
+
+    explicit Lock(const uint8_t stages) : target(stages) {}
+
+    bool goal(const Memory &memory) const noexcept override { return memory[stage] == target; }
+
+    int64_t score(const Memory &memory) const noexcept override { return memory[stage]; }
+
+    static CPU::Snapshot boot(const std::initializer_list<uint8_t> combination) {
+        Memory::Data data{};
+        std::ranges::copy(std::initializer_list<uint8_t>{
+                              0xA5, 0xF0,       // wait: LDA $F0
+                              0xF0, 0xFC,       // BEQ wait
+                              0xA6, 0x10,       // LDX $10
+                              0xDD, 0x00, 0x03, // CMP $0300,X
+                              0xD0, 0x05,       // BNE wrong
+                              0xE6, 0x10,       // INC $10
+                              0x4C, 0x14, 0x02, // JMP clear
+                              0xA9, 0x00,       // wrong: LDA #0
+                              0x85, 0x10,       // STA $10
+                              0xA9, 0x00,       // clear: LDA #0
+                              0x85, 0xF0,       // STA $F0
+                              0x4C, 0x00, 0x02, // JMP wait
+                          },
+                          data.begin() + 0x0200);
+        std::ranges::copy(combination, data.begin() + secret);
+        data[CPU::RES + 1] = 0x02;
+        const auto cpu     = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+        return cpu->snapshot();
+    }
+};
+
+std::vector<uint8_t> digits() {
+    std::vector<uint8_t> values(8);
+    std::iota(values.begin(), values.end(), 1);
+    return values;
+}
+
+TEST(Search, Exhaustive) {
+    Search search({ .input = Lock::input, .candidates = digits(), .frame = 100, .depth = 6, .threads = 4 });
+    const auto result = search.run(Lock::boot({ 3, 1, 4, 1, 5 }), Lock(5));
+    ASSERT_TRUE(result.found);
+    EXPECT_EQ(result.inputs, (std::vector<uint8_t>{ 3, 1, 4, 1, 5 }));
+    ASSERT_TRUE(result.state);
+    EXPECT_EQ(result.state->memory[Lock::stage], 5);
+
+    // The wrong inputs lead back to the few states of the first stage, so most of the forks are duplicates
+    EXPECT_LT(result.states, 50);
+    EXPECT_GT(result.duplicates, 50);
+}
+
+TEST(Search, Beam) {
+    Search search({ .input = Lock::input, .candidates = digits(), .frame = 100, .depth = 8, .beam = 1 });
+    const auto result = search.run(Lock::boot({ 8, 7, 6, 5, 4, 3, 2 }), Lock(7));
+    ASSERT_TRUE(result.found);
+    EXPECT_EQ(result.inputs, (std::vector<uint8_t>{ 8, 7, 6, 5, 4, 3, 2 }));
+    EXPECT_LE(result.states, 1 + 7 * 3); // the correct input and the wrong ones, which only differ in X
+}
+
+TEST(Search, Unreachable) {
+    Search search({ .input = Lock::input, .candidates = { 1, 2 }, .frame = 100, .depth = 20, .threads = 2 });
+    const auto result = search.run(Lock::boot({ 3, 3 }), Lock(2));
+    EXPECT_FALSE(result.found);
+    EXPECT_TRUE(result.inputs.empty());
+    EXPECT_FALSE(result.state);
+    EXPECT_LE(result.states, 3);
+}
+
+TEST(Search, StartAtGoal) {
+    Search search({ .input = Lock::input, .candidates = digits() });
+    const auto result = search.run(Lock::boot({ 1 }), Lock(0));
+    EXPECT_TRUE(result.found);
+    EXPECT_TRUE(result.inputs.empty());
+    EXPECT_EQ(result.states, 1);
+}
+
+/**
+ * @brief Program counting the inputs and keeping the parity of the last one, so many sequences reach each state
+ */
+struct Parity : Objective {
+    bool goal(const Memory &memory) const noexcept override { return memory[0x11] == 2 && memory[0x10] == 1; }
+
+    static CPU::Snapshot boot() {
+        Memory::Data data{};
+        std::ranges::copy(std::initializer_list<uint8_t>{
+                              0xA5, 0xF0,       // wait: LDA $F0
+                              0xF0, 0xFC,       // BEQ wait
+                              0x29, 0x01,       // AND #1
+                              0x85, 0x10,       // STA $10
+                              0xA9, 0x00,       // LDA #0
+                              0x85, 0xF0,       // STA $F0
+                              0xE6, 0x11,       // INC $11
+                              0x4C, 0x00, 0x02, // JMP wait
+                          },
+                          data.begin() + 0x0200);
+        data[CPU::RES + 1] = 0x02;
+        const auto cpu     = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+        return cpu->snapshot();
+    }
+};
+
+TEST(Search, Deterministic) {
+    const auto start = Parity::boot();
+    for (size_t run = 0; run < 20; ++run) {
+        Search search({ .input = 0xF0, .candidates = digits(), .frame = 100, .depth = 3, .threads = 8 });
+        const auto result = search.run(start, Parity());
+        ASSERT_TRUE(result.found);
+        // The first fork of the level reaching a state is kept, whichever worker executes it first
+        EXPECT_EQ(result.inputs, (std::vector<uint8_t>{ 1, 1 }));
+        EXPECT_EQ(result.states, 1 + 2 + 2); // both parities after each input
+    }
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,89 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "SingleStep.hpp"
+
+#include <gtest/gtest.h>
+#include <string>
+
+namespace emulator::mos_6502::test {
+namespace {
+// LDA #$80 and STA $10 from $0200, in the format of the corpus
+constexpr std::string_view corpus = R"([
+  {
+    "name": "a9 80 00",
+    "initial": { "pc": 512, "s": 253, "a": 0, "x": 0, "y": 0, "p": 36, "ram": [ [512, 169], [513, 128] ] },
+    "final": { "pc": 514, "s": 253, "a": 128, "x": 0, "y": 0, "p": 164, "ram": [ [512, 169], [513, 128] ] },
+    "cycles": [ [512, 169, "read"], [513, 128, "read"] ]
+  },
+  {
+    "name": "85 10 00",
+    "initial": { "pc": 512, "s": 253, "a": 66, "x": 0, "y": 0, "p": 36, "ram": [ [512, 133], [513, 16] ] },
+    "final": { "pc": 514, "s": 253, "a": 66, "x": 0, "y": 0, "p": 36, "ram": [ [16, 66] ] },
+    "cycles": [ [512, 133, "read"], [513, 16, "read"], [16, 66, "write"] ],
+    "extra": { "nested": [1, "]", { "x": null }] }
+  }
+])";
+} // namespace
+
+TEST(SingleStep, Parse) {
+    SingleStepReader reader{ corpus };
+    SingleStepTest test;
+    ASSERT_TRUE(reader.next(test));
+    EXPECT_EQ(test.name, "a9 80 00");
+    EXPECT_EQ(test.initial.registers.PC, 0x0200);
+    EXPECT_EQ(test.final.registers.A, 0x80);
+    EXPECT_TRUE(test.final.registers.SR.negative);
+    EXPECT_EQ(test.initial.ram.size(), 2);
+    EXPECT_EQ(test.cycles.size(), 2);
+
+    ASSERT_TRUE(reader.next(test));
+    EXPECT_EQ(test.name, "85 10 00");
+    ASSERT_EQ(test.final.ram.size(), 1);
+    EXPECT_EQ(test.final.ram[0], std::make_pair(uint16_t{ 0x10 }, uint8_t{ 0x42 }));
+    EXPECT_EQ(test.cycles.back(), (SingleStepTest::Cycle{ .address = 0x10, .value = 0x42, .access = Access::Write }));
+
+    EXPECT_FALSE(reader.next(test));
+    EXPECT_FALSE(reader.failed());
+}
+
+TEST(SingleStep, Malformed) {
+    SingleStepReader reader{ R"([{ "name": "a9", "cycles": [[512, 169, "fetch"]] }])" };
+    SingleStepTest test;
+    EXPECT_FALSE(reader.next(test));
+    EXPECT_TRUE(reader.failed());
+}
+
+TEST(SingleStep, Run) {
+    SingleStepReader reader{ corpus };
+    SingleStepRunner runner;
+    SingleStepTest test;
+    while (reader.next(test)) EXPECT_EQ(runner.run(test), SingleStepRunner::Result::Passed) << runner.failure();
+}
+
+TEST(SingleStep, Mismatch) {
+    SingleStepReader reader{ corpus };
+    SingleStepRunner runner;
+    SingleStepTest test;
+    ASSERT_TRUE(reader.next(test));
+    ASSERT_TRUE(reader.next(test));
+    test.final.ram[0].second = 0x43;
+    test.cycles.pop_back();
+    EXPECT_EQ(runner.run(test), SingleStepRunner::Result::Failed);
+    EXPECT_EQ(runner.failure(), "[$0010] $43 expected, $42 found; cycle 3: none expected, write $0010=$42 found; "
+                                "2 cycles expected, 3 taken");
+
+    // The memory of the failed case does not leak into the next one
+    test.final.ram[0].second = 0x42;
+    test.cycles.push_back({ .address = 0x10, .value = 0x42, .access = Access::Write });
+    EXPECT_EQ(runner.run(test), SingleStepRunner::Result::Passed) << runner.failure();
+}
+
+TEST(SingleStep, Unsupported) {
+    SingleStepTest test;
+    test.initial.registers.PC = 0x0200;
+    test.initial.ram          = { { 0x0200, 0x02 } };
+    SingleStepRunner runner;
+    EXPECT_EQ(runner.run(test), SingleStepRunner::Result::Unsupported);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,81 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "TimeSharing.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Create an instance endlessly incrementing $10, or jamming after a number of NOPs
+ */
+std::unique_ptr<CPU> tenant(const size_t nops = 0) {
+    Memory::Data data{};
+    if (nops == 0) {
+        // INC $10; JMP $0200
+        std::ranges::copy(std::initializer_list<uint8_t>{ 0xE6, 0x10, 0x4C, 0x00, 0x02 }, data.begin() + 0x0200);
+    } else {
+        std::fill_n(data.begin() + 0x0200, nops, 0xEA);
+        data[0x0200 + nops] = 0x02;
+    }
+    data[CPU::RES + 1] = 0x02;
+
+    auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+    cpu->reset();
+    return cpu;
+}
+
+TEST(TimeSharing, RoundRobin) {
+    TimeSharing sharing(100);
+    const auto first  = sharing.spawn(tenant());
+    const auto second = sharing.spawn(tenant());
+
+    EXPECT_TRUE(sharing.step());
+    EXPECT_GE(sharing.consumed(first), 100);
+    EXPECT_EQ(sharing.consumed(second), 0);
+    EXPECT_TRUE(sharing.step());
+    EXPECT_EQ(sharing.consumed(second), sharing.consumed(first));
+}
+
+TEST(TimeSharing, Priorities) {
+    TimeSharing sharing(50);
+    const auto low  = sharing.spawn(tenant(), 1, 100'000);
+    const auto high = sharing.spawn(tenant(), 3, 300'000);
+
+    for (int i = 0; i < 4'000; ++i) EXPECT_TRUE(sharing.step());
+    const auto ratio = static_cast<double>(sharing.consumed(high)) / static_cast<double>(sharing.consumed(low));
+    EXPECT_NEAR(ratio, 3.0, 0.05);
+
+    sharing.run();
+    EXPECT_EQ(sharing.state(low), TimeSharing::State::Exhausted);
+    EXPECT_EQ(sharing.state(high), TimeSharing::State::Exhausted);
+    EXPECT_GE(sharing.consumed(low), 100'000);
+    EXPECT_LT(sharing.consumed(low), 100'000 + 8);
+}
+
+TEST(TimeSharing, Quota) {
+    TimeSharing sharing(1'000);
+    const auto context = sharing.spawn(tenant(), 1, 500);
+    sharing.run();
+    EXPECT_EQ(sharing.state(context), TimeSharing::State::Exhausted);
+    const auto rounds = sharing.instance(context).memory()[0x10];
+    EXPECT_EQ(rounds, 63); // 8 cycles per round
+
+    sharing.set_quota(context, 1'000);
+    EXPECT_EQ(sharing.state(context), TimeSharing::State::Ready);
+    sharing.run();
+    EXPECT_GT(sharing.instance(context).memory()[0x10], rounds);
+}
+
+TEST(TimeSharing, Stopped) {
+    TimeSharing sharing(10);
+    const auto jammed  = sharing.spawn(tenant(20));
+    const auto running = sharing.spawn(tenant(), 1, 1'000);
+    sharing.run();
+    EXPECT_EQ(sharing.state(jammed), TimeSharing::State::Stopped);
+    EXPECT_EQ(sharing.consumed(jammed), 41); // 20 NOPs and the fetch of the illegal opcode
+    EXPECT_EQ(sharing.state(running), TimeSharing::State::Exhausted);
+    EXPECT_FALSE(sharing.step());
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,159 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Guard.hpp"
+#include "TimeTravel.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace emulator::mos_6502::test {
+/**
+ * @brief Input port returning a different random value on every read
+ */
+struct Noise : Device {
+    std::mt19937 generator{ 7 };
+
+    void synchronize(size_t) noexcept override {}
+
+    uint8_t read(uint16_t) noexcept override { return static_cast<uint8_t>(generator()); }
+
+    void write(uint16_t, uint8_t) noexcept override {}
+};
+
+struct Travelling : testing::Test {
+    static constexpr size_t interval = 1'000;
+
+    std::unique_ptr<CPU> cpu;
+
+    Scheduler scheduler;
+
+    Noise noise;
+
+    /// @brief State at every recorded instruction boundary
+    struct Boundary {
+        size_t cycle;
+        CPU::Registers registers;
+        uint8_t sample; ///< Byte the program last stored
+    };
+
+    std::vector<Boundary> history;
+
+    void SetUp() override {
+        Memory::Data data{};
+        // LDA $D000; STA $0400,X; INC $10; LDX $10; JMP $0200
+        std::ranges::copy(std::initializer_list<uint8_t>{ 0xAD, 0x00, 0xD0, 0x9D, 0x00, 0x04, 0xE6, 0x10, 0xA6, 0x10,
+                                                          0x4C, 0x00, 0x02 },
+                          data.begin() + 0x0200);
+        data[CPU::RES + 1] = 0x02;
+        cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        cpu->reset();
+        scheduler.map(noise, 0xD0, 0xD0);
+        cpu->set_scheduler(&scheduler);
+    }
+
+    void advance(TimeTravel &session, const size_t steps) {
+        for (size_t i = 0; i < steps; ++i) {
+            EXPECT_TRUE(session.step());
+            remember();
+        }
+    }
+
+    void remember() {
+        const auto x = static_cast<uint8_t>(cpu->memory()[0x10] - 1);
+        history.push_back({ cpu->cycle(), cpu->registers(), cpu->memory()[0x0400 + x] });
+    }
+
+    void expect_at(const Boundary &expected) const {
+        EXPECT_EQ(cpu->cycle(), expected.cycle);
+        EXPECT_EQ(cpu->registers(), expected.registers);
+        const auto x = static_cast<uint8_t>(cpu->memory()[0x10] - 1);
+        EXPECT_EQ(cpu->memory()[0x0400 + x], expected.sample);
+    }
+};
+
+TEST_F(Travelling, Seek) {
+    TimeTravel session(*cpu, interval);
+    remember();
+    advance(session, 5'000);
+    EXPECT_EQ(session.frontier(), cpu->cycle());
+
+    std::mt19937 generator(1);
+    for (size_t i = 0; i < 100; ++i) {
+        const auto &target = history[generator() % history.size()];
+        ASSERT_TRUE(session.seek(target.cycle));
+        expect_at(target);
+    }
+    EXPECT_FALSE(session.journal().diverged());
+
+    // Past the frontier, the execution continues live
+    ASSERT_TRUE(session.seek(history[4'000].cycle));
+    const auto frontier = session.frontier();
+    ASSERT_TRUE(session.seek(frontier + 10 * interval));
+    EXPECT_GT(session.frontier(), frontier + 10 * interval - 10);
+    ASSERT_TRUE(session.seek(history.back().cycle));
+    expect_at(history.back());
+}
+
+TEST_F(Travelling, ReverseStep) {
+    TimeTravel session(*cpu, interval);
+    remember();
+    advance(session, 3'000);
+
+    for (size_t i = history.size() - 1; i > history.size() - 600; --i) {
+        ASSERT_TRUE(session.reverse_step());
+        expect_at(history[i - 1]);
+    }
+
+    // Stepping forward again replays the same instructions, then resumes the recording
+    const auto resumed = cpu->cycle();
+    for (size_t i = 0; i < 700; ++i) ASSERT_TRUE(session.step());
+    EXPECT_GT(session.frontier(), history.back().cycle);
+    ASSERT_TRUE(session.seek(resumed));
+    for (size_t i = history.size() - 599; i < history.size(); ++i) {
+        ASSERT_TRUE(session.step());
+        expect_at(history[i]);
+    }
+
+    ASSERT_TRUE(session.seek(history.front().cycle));
+    EXPECT_FALSE(session.reverse_step());
+}
+
+TEST_F(Travelling, ReverseStepStopped) {
+    TimeTravel session(*cpu, interval);
+    advance(session, 100);
+
+    Guard guard;
+    guard.permit(0x04, 0x04, { Access::Read }); // the stores of the program are denied in the re-execution
+    cpu->set_guard(&guard);
+    EXPECT_FALSE(session.reverse_step());
+    EXPECT_TRUE(guard.violation());
+    cpu->set_guard(nullptr);
+}
+
+TEST_F(Travelling, LastWrite) {
+    TimeTravel session(*cpu, interval);
+    remember();
+    advance(session, 2'000);
+    EXPECT_FALSE(session.last_write(0x10, history.front().cycle + 1));
+    EXPECT_EQ(session.write_log().writes(0x10).size(), 2'000 / 5 * 2); // INC writes twice
+    EXPECT_FALSE(session.write_log().overflowed());
+
+    for (size_t i = 0; i < history.size(); i += 37) {
+        ASSERT_TRUE(session.seek(history[i].cycle));
+        for (const uint16_t address : { uint16_t{ 0x10 }, uint16_t{ 0x0400 }, uint16_t{ 0x04FF } }) {
+            const auto write = session.last_write(address, cpu->cycle() + 1);
+            EXPECT_EQ(write ? write->value : 0, cpu->memory()[address]);
+            if (write) {
+                EXPECT_LE(write->cycle, cpu->cycle());
+            }
+        }
+    }
+
+    // Re-executing the past does not log its writes again
+    EXPECT_EQ(session.write_log().writes(0x10).size(), 2'000 / 5 * 2);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,79 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "MappedFile.hpp"
+#include "Trace.hpp"
+
+#include <gtest/gtest.h>
+
+namespace emulator::mos_6502::test {
+TEST(Trace, ParseReference) {
+    const auto record = TraceRecord::parse_reference(
+            "C72C  D0 E0     BNE $C70E                       A:40 X:0A Y:FF P:E5 SP:FB PPU: 33,127 CYC:3817");
+    ASSERT_TRUE(record);
+    EXPECT_EQ(record->PC, 0xC72C);
+    EXPECT_EQ(record->opcode, 0xD0);
+    EXPECT_EQ(record->A, 0x40);
+    EXPECT_EQ(record->X, 0x0A);
+    EXPECT_EQ(record->Y, 0xFF);
+    EXPECT_EQ(record->P, 0xE5);
+    EXPECT_EQ(record->SP, 0xFB);
+    EXPECT_EQ(record->cycle, 3817);
+}
+
+TEST(Trace, ParseMalformedReference) {
+    EXPECT_FALSE(TraceRecord::parse_reference(""));
+    EXPECT_FALSE(TraceRecord::parse_reference("C72C  D0 E0     BNE $C70E"));
+    EXPECT_FALSE(TraceRecord::parse_reference("C72C  D0 E0  A:40 X:0A Y:FF P:E5 SP:FB CYC:"));
+    EXPECT_FALSE(TraceRecord::parse_reference("G72C  D0 E0  A:40 X:0A Y:FF P:E5 SP:FB CYC:1"));
+}
+
+TEST(Trace, Comparison) {
+    const TraceRecord reference{
+        .cycle = 7, .PC = 0xC000, .A = 0, .X = 0, .Y = 0, .P = 0x24, .SP = 0xFD, .opcode = 0x4C
+    };
+
+    auto actual = reference;
+    actual.P    = 0x34; // the break flag does not exist in hardware
+    EXPECT_TRUE(actual.matches(reference));
+    EXPECT_EQ(actual.mismatches(reference), "");
+
+    actual.X     = 1;
+    actual.cycle = 8;
+    EXPECT_FALSE(actual.matches(reference));
+    EXPECT_EQ(actual.mismatches(reference), "X CYC");
+}
+
+TEST(Trace, RoundTrip) {
+    Memory::Data data{};
+    data[CPU::RES]     = 0x00;
+    data[CPU::RES + 1] = 0xC0;
+    data[0xC000]       = 0xA9; // LDA #$42
+    data[0xC001]       = 0x42;
+    CPU cpu{ std::chrono::nanoseconds(0), Memory{ data } };
+    cpu.reset();
+
+    const auto path = std::filesystem::temp_directory_path() / "emulator_trace_round_trip.bin";
+    {
+        TraceWriter writer{ path };
+        writer.record(cpu);
+        EXPECT_TRUE(cpu.step());
+        writer.record(cpu);
+        writer.flush();
+        EXPECT_TRUE(writer.good());
+    }
+
+    const auto file = MappedFile::open(path);
+    ASSERT_TRUE(file);
+    ASSERT_EQ(file->bytes().size(), 2 * sizeof(TraceRecord));
+    const auto *records = reinterpret_cast<const TraceRecord *>(file->bytes().data());
+
+    const auto expected_first  = TraceRecord::parse_reference("C000  A9 42  LDA #$42  A:00 X:00 Y:00 P:24 SP:FD CYC:7");
+    const auto expected_second = TraceRecord::parse_reference("C002  00     BRK       A:42 X:00 Y:00 P:24 SP:FD CYC:9");
+    ASSERT_TRUE(expected_first && expected_second);
+    EXPECT_EQ(records[0].mismatches(*expected_first), "");
+    EXPECT_EQ(records[1].mismatches(*expected_second), "");
+
+    std::filesystem::remove(path);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,68 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Trap.hpp"
+
+#include <gtest/gtest.h>
+#include <initializer_list>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+struct Trapping : testing::Test {
+    static constexpr uint16_t origin = 0x0200;
+
+    std::unique_ptr<CPU> cpu;
+
+    /**
+     * @brief Create a CPU that starts executing a program at the origin
+     */
+    void load(const std::initializer_list<uint8_t> program) {
+        Memory::Data data{};
+        std::ranges::copy(program, data.begin() + origin);
+        cpu            = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ data });
+        auto registers = cpu->registers();
+        registers.PC   = origin;
+        cpu->set_registers(registers);
+    }
+};
+
+TEST_F(Trapping, JumpToItself) {
+    // LDX #$03; DEX; BNE -3; JMP $0205
+    load({ 0xA2, 0x03, 0xCA, 0xD0, 0xFD, 0x4C, 0x05, 0x02 });
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Loop);
+    EXPECT_EQ(trap.PC, 0x0205);
+    EXPECT_EQ(trap.instructions, 1 + 3 * 2 + 1);
+    EXPECT_EQ(trap.cycles, 2 + 3 * 2 + 2 * 3 + 2 + 3);
+}
+
+TEST_F(Trapping, BranchToItself) {
+    load({ 0x18, 0x90, 0xFE }); // CLC; BCC *
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Loop);
+    EXPECT_EQ(trap.PC, 0x0201);
+}
+
+TEST_F(Trapping, ReturnToItself) {
+    // JSR $0206; JMP $0203; JSR $0209; RTS
+    load({ 0x20, 0x06, 0x02, 0x4C, 0x03, 0x02, 0x20, 0x09, 0x02, 0x60 });
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Loop);
+    EXPECT_EQ(trap.PC, 0x0203); // the first RTS returns to itself, but it is not a trap
+}
+
+TEST_F(Trapping, Stopped) {
+    load({ 0xEA, 0x02 }); // NOP; illegal opcode
+    const auto trap = Trap::wait(*cpu, 1000);
+    EXPECT_EQ(trap.kind, Trap::Kind::Stopped);
+    EXPECT_EQ(trap.PC, 0x0201);
+    EXPECT_EQ(trap.instructions, 1);
+}
+
+TEST_F(Trapping, Limit) {
+    load({ 0xEA, 0x4C, 0x00, 0x02 }); // NOP; JMP $0200
+    const auto trap = Trap::wait(*cpu, 100);
+    EXPECT_EQ(trap.kind, Trap::Kind::Limit);
+    EXPECT_GE(trap.cycles, 100);
+}
+} // namespace emulator::mos_6502::test
@@ -0,0 +1,35 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+#include "Trap.hpp"
+#include "Workload.hpp"
+
+#include <gtest/gtest.h>
+#include <memory>
+
+namespace emulator::mos_6502::test {
+TEST(Workloads, ReachExpectedState) {
+    const auto workloads = Workload::all();
+    ASSERT_EQ(workloads.size(), 5);
+    for (const auto &workload : workloads) {
+        const auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ workload.image });
+        cpu->reset();
+        EXPECT_EQ(cpu->registers().PC, workload.entry) << workload.name;
+
+        const auto trap = Trap::wait(*cpu, 100'000'000);
+        EXPECT_EQ(trap.kind, Trap::Kind::Loop) << workload.name;
+        EXPECT_EQ(trap.PC, workload.trap) << workload.name;
+        EXPECT_GT(trap.cycles, 100'000) << workload.name;
+        EXPECT_TRUE(workload.verify(cpu->memory())) << workload.name;
+    }
+}
+
+TEST(Workloads, Deterministic) {
+    const auto first  = Workload::all();
+    const auto second = Workload::all();
+    for (size_t i = 0; i < first.size(); ++i) {
+        EXPECT_EQ(first[i].image, second[i].image);
+        EXPECT_EQ(first[i].expected, second[i].expected);
+    }
+}
+} // namespace emulator::mos_6502::test
@@ -13,11 +13,15 @@ struct BinaryArithmetic : testing::TestWithParam<TestParameters> {
     uint8_t input_first  = 0;
     uint8_t input_second = 0;
     uint8_t output       = 0;
+    bool subtraction     = false;
 
     void TearDown() override {
+        // Subtracting is adding the complement, and the sum overflows if it has the sign other than both values
+        const auto operand = subtraction ? static_cast<uint8_t>(~input_second) : input_second;
         EXPECT_EQ(sr.negative, static_cast<int8_t>(output) < 0) << "result = " << static_cast<int>(output);
-        EXPECT_EQ(sr.overflow, (static_cast<int8_t>(input_first) < 0) != (static_cast<int8_t>(output) < 0))
-                << static_cast<int>(input_first) << " -> " << static_cast<int>(output);
+        EXPECT_EQ(sr.overflow, (~(input_first ^ operand) & (input_first ^ output) & 0x80) != 0)
+                << static_cast<int>(input_first) << ", " << static_cast<int>(input_second) << " -> "
+                << static_cast<int>(output);
         EXPECT_FALSE(sr.break_);
         EXPECT_FALSE(sr.decimal);
         EXPECT_FALSE(sr.interrupt);
@@ -91,6 +95,7 @@ struct BinarySubtraction : BinaryArithmetic {
 
     void SetUp() override {
         std::tie(input_first, input_second, input_borrow, output) = GetParam();
+        subtraction                                               = true;
 
         sr = { .negative  = false,
                .overflow  = false,
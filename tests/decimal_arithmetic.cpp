@@ -13,11 +13,12 @@ struct DecimalArithmetic : testing::TestWithParam<TestParameters> {
     uint8_t input_first  = 0;
     uint8_t input_second = 0;
     uint8_t output       = 0;
+    bool overflow        = false; ///< Expected overflow flag, which the NMOS 6502 takes from a binary sum
 
     void TearDown() override {
         EXPECT_EQ(sr.negative, static_cast<int8_t>(output) < 0) << "result = " << static_cast<int>(output);
-        EXPECT_EQ(sr.overflow, (static_cast<int8_t>(input_first) < 0) != (static_cast<int8_t>(output) < 0))
-                << static_cast<int>(input_first) << " -> " << static_cast<int>(output);
+        EXPECT_EQ(sr.overflow, overflow) << static_cast<int>(input_first) << ", " << static_cast<int>(input_second)
+                                         << " -> " << static_cast<int>(output);
         EXPECT_FALSE(sr.break_);
         EXPECT_TRUE(sr.decimal);
         EXPECT_FALSE(sr.interrupt);
@@ -32,6 +33,11 @@ struct DecimalAddition : DecimalArithmetic {
     void SetUp() override {
         std::tie(input_first, input_second, input_carry, output, output_carry) = GetParam();
 
+        // The high digits with the carry of the adjusted low digits, before their own adjustment
+        const bool low_carry   = (input_first & 0x0F) + (input_second & 0x0F) + input_carry > 9;
+        const auto high_digits = static_cast<uint8_t>((input_first & 0xF0) + (input_second & 0xF0) + low_carry * 0x10);
+        overflow               = (~(input_first ^ input_second) & (input_first ^ high_digits) & 0x80) != 0;
+
         sr = { .negative  = false,
                .overflow  = false,
                .break_    = false,
@@ -82,6 +88,14 @@ INSTANTIATE_TEST_SUITE_P(NoOverflow,
                                            TestParameters{ 0x00, 0x09, true, 0x10, false },
                                            TestParameters{ 0x10, 0x20, true, 0x31, false }));
 
+// The digits above 9 are not decimal, but the results must be the same as of the NMOS 6502
+INSTANTIATE_TEST_SUITE_P(InvalidDigits,
+                         DecimalAddition,
+                         ::testing::Values(TestParameters{ 0x0F, 0x01, false, 0x16, false },
+                                           TestParameters{ 0x9A, 0x00, false, 0x00, true },
+                                           TestParameters{ 0xFF, 0xFF, true, 0x55, true },
+                                           TestParameters{ 0xA0, 0x00, false, 0x00, true }));
+
 struct DecimalSubtraction : DecimalArithmetic {
     bool input_borrow  = false;
     bool output_borrow = false;
@@ -89,6 +103,9 @@ struct DecimalSubtraction : DecimalArithmetic {
     void SetUp() override {
         std::tie(input_first, input_second, input_borrow, output, output_borrow) = GetParam();
 
+        const auto difference = static_cast<uint8_t>(input_first - input_second - input_borrow);
+        overflow              = ((input_first ^ input_second) & (input_first ^ difference) & 0x80) != 0;
+
         sr = { .negative  = false,
                .overflow  = false,
                .break_    = false,
@@ -138,4 +155,11 @@ INSTANTIATE_TEST_SUITE_P(NoOverflow,
                                            TestParameters{ 0x11, 0x02, false, 0x09, false },
                                            TestParameters{ 0x21, 0x12, true, 0x08, false },
                                            TestParameters{ 0x99, 0x98, false, 0x01, false }));
+
+INSTANTIATE_TEST_SUITE_P(InvalidDigits,
+                         DecimalSubtraction,
+                         ::testing::Values(TestParameters{ 0x1A, 0x00, false, 0x1A, false },
+                                           TestParameters{ 0x00, 0x0F, false, 0x9B, true },
+                                           TestParameters{ 0xFF, 0x00, true, 0xFE, false },
+                                           TestParameters{ 0x0A, 0x0F, false, 0x95, true }));
 } // namespace emulator::mos_6502::test
\ No newline at end of file
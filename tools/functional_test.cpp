@@ -0,0 +1,87 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Run a self-checking test image, such as 6502_functional_test.bin of Klaus Dormann, as fast as possible
+// until it traps, and report whether it trapped at the success address together with the throughput.
+// The run is deterministic, so the throughput of the same image is comparable between the releases.
+//
+#include "CPU.hpp"
+#include "MappedFile.hpp"
+#include "Trace.hpp"
+#include "Trap.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+using namespace emulator::mos_6502;
+
+namespace {
+/**
+ * @brief Parse a command-line number in a given base
+ */
+template <typename T>
+[[nodiscard]] std::optional<T> parse(const std::string_view text, const int base) noexcept {
+    T value{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    if (error != std::errc{} || end != text.data() + text.size()) return std::nullopt;
+    return value;
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    if (argc != 5 && argc != 6) {
+        std::cerr << "Usage: " << argv[0] << " <image> <load address> <entry PC> <success PC> [cycle limit]\n"
+                  << "Addresses are hexadecimal, e.g. 0400\n";
+        return 2;
+    }
+
+    const auto load_address = parse<uint16_t>(argv[2], 16);
+    const auto entry        = parse<uint16_t>(argv[3], 16);
+    const auto success      = parse<uint16_t>(argv[4], 16);
+    const auto limit        = argc == 6 ? parse<size_t>(argv[5], 10) : std::make_optional<size_t>(1'000'000'000);
+    if (!load_address || !entry || !success || !limit) {
+        std::cerr << "Invalid arguments\n";
+        return 2;
+    }
+
+    const auto image = MappedFile::open(argv[1]);
+    if (!image) {
+        std::cerr << "Cannot map " << argv[1] << '\n';
+        return 2;
+    }
+
+    Memory::Data data{};
+    const auto bytes = image->bytes().first(std::min(image->bytes().size(), data.size() - *load_address));
+    std::ranges::transform(bytes, data.begin() + *load_address, [](const std::byte b) {
+        return std::to_integer<uint8_t>(b);
+    });
+
+    CPU cpu{ std::chrono::nanoseconds(0), Memory{ data } };
+    cpu.reset();
+    auto registers = cpu.registers();
+    registers.PC   = *entry;
+    cpu.set_registers(registers);
+
+    const auto start                            = std::chrono::steady_clock::now();
+    const auto trap                             = Trap::wait(cpu, *limit);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    switch (trap.kind) {
+    case Trap::Kind::Loop:
+        std::cout << (trap.PC == *success ? "Success" : "Failure") << ": trapped at $" << std::hex << std::uppercase
+                  << std::setw(4) << std::setfill('0') << trap.PC << std::dec << std::nouppercase << '\n';
+        break;
+    case Trap::Kind::Stopped: std::cout << "Failure: the CPU stopped\n"; break;
+    case Trap::Kind::Limit: std::cout << "Failure: no trap within " << *limit << " cycles\n"; break;
+    }
+    std::cout << TraceRecord::capture(cpu) << '\n'
+              << trap.instructions << " instructions, " << trap.cycles << " cycles in " << elapsed.count() << " s: "
+              << static_cast<double>(trap.cycles) / elapsed.count() / 1e6 << " MHz, "
+              << static_cast<double>(trap.instructions) / elapsed.count() / 1e6 << " MIPS\n";
+    return trap.kind == Trap::Kind::Loop && trap.PC == *success ? 0 : 1;
+}
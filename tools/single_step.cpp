@@ -0,0 +1,137 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Run the SingleStepTests (ProcessorTests) corpus of the 6502, one JSON file of cases per opcode.
+// The files are mapped and parsed in a streaming fashion, and distributed between all the cores.
+// Every case checks the registers, the memory and every bus cycle of a single instruction.
+//
+#include "MappedFile.hpp"
+#include "SingleStep.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace emulator::mos_6502;
+
+namespace {
+/// @brief Number of failed cases printed for every file
+constexpr size_t shown = 3;
+
+struct Report {
+    size_t passed      = 0;
+    size_t failed      = 0;
+    size_t unsupported = 0;
+    std::string error; ///< Why the file could not be processed completely, if it could not
+    std::vector<std::string> failures;
+};
+
+/**
+ * @brief Run all the cases of a file
+ */
+Report run(const std::filesystem::path &path, SingleStepRunner &runner, SingleStepTest &test) {
+    Report report;
+    const auto file = MappedFile::open(path);
+    if (!file) {
+        report.error = "cannot be mapped";
+        return report;
+    }
+
+    SingleStepReader reader{ file->text() };
+    while (reader.next(test)) {
+        switch (runner.run(test)) {
+        case SingleStepRunner::Result::Passed: ++report.passed; break;
+        case SingleStepRunner::Result::Unsupported: ++report.unsupported; break;
+        case SingleStepRunner::Result::Failed:
+            if (report.failed++ < shown) report.failures.push_back(std::string(test.name) + ": " + runner.failure());
+            break;
+        }
+    }
+    if (reader.failed()) report.error = "malformed at offset " + std::to_string(reader.position());
+    return report;
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    unsigned threads = std::max(std::thread::hardware_concurrency(), 1u);
+    int first        = 1;
+    if (argc > 2 && std::string_view{ argv[1] } == "-j") {
+        const std::string_view argument = argv[2];
+        if (std::from_chars(argument.data(), argument.data() + argument.size(), threads).ec != std::errc{}
+            || threads == 0) {
+            std::cerr << "Invalid number of threads: " << argument << '\n';
+            return 2;
+        }
+        first = 3;
+    }
+    if (first >= argc) {
+        std::cerr << "Usage: " << argv[0] << " [-j threads] <file.json | directory>...\n";
+        return 2;
+    }
+
+    std::vector<std::filesystem::path> files;
+    for (int i = first; i < argc; ++i) {
+        std::error_code error;
+        if (!std::filesystem::is_directory(argv[i], error)) {
+            files.emplace_back(argv[i]);
+            continue;
+        }
+        for (const auto &entry : std::filesystem::directory_iterator(argv[i], error))
+            if (entry.is_regular_file() && entry.path().extension() == ".json") files.push_back(entry.path());
+        if (error) {
+            std::cerr << "Cannot list " << argv[i] << ": " << error.message() << '\n';
+            return 2;
+        }
+    }
+    std::ranges::sort(files);
+
+    std::vector<Report> reports(files.size());
+    std::atomic<size_t> next = 0;
+    const auto work          = [&] {
+        // The runner holds a whole address space, so it does not belong on the stack
+        const auto runner = std::make_unique<SingleStepRunner>();
+        SingleStepTest test;
+        for (auto index = next++; index < files.size(); index = next++)
+            reports[index] = run(files[index], *runner, test);
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned i = 1; i < std::min<size_t>(threads, files.size()); ++i) workers.emplace_back(work);
+        work();
+    }
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    Report total;
+    size_t broken = 0;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto &report = reports[i];
+        total.passed += report.passed;
+        total.failed += report.failed;
+        total.unsupported += report.unsupported;
+        if (!report.error.empty()) {
+            ++broken;
+            std::cout << files[i].string() << ": " << report.error << '\n';
+        }
+        if (report.failed == 0) continue;
+
+        std::cout << files[i].string() << ": " << report.failed << " of "
+                  << report.passed + report.failed + report.unsupported << " cases failed\n";
+        for (const auto &failure : report.failures) std::cout << "  " << failure << '\n';
+    }
+
+    const auto cases = total.passed + total.failed + total.unsupported;
+    std::cout << cases << " cases in " << files.size() << " files: " << total.passed << " passed, " << total.failed
+              << " failed, " << total.unsupported << " unsupported\n"
+              << elapsed.count() << " s on " << threads << " threads, "
+              << static_cast<size_t>(static_cast<double>(cases) / std::max(elapsed.count(), 1e-9)) << " cases/s\n";
+    return total.failed == 0 && broken == 0 ? 0 : 1;
+}
@@ -0,0 +1,121 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Compare a binary trace recorded by TraceWriter against a reference log in the format of nestest.log.
+// Both files are mapped into memory and streamed side by side; the comparison stops at the first divergence.
+// The exit status is 0 if the traces match entirely, 1 if they diverge or one ends before the other,
+// and 2 if the input is invalid.
+//
+#include "MappedFile.hpp"
+#include "Trace.hpp"
+
+#include <charconv>
+#include <deque>
+#include <iostream>
+#include <span>
+
+using emulator::mos_6502::MappedFile;
+using emulator::mos_6502::TraceRecord;
+
+namespace {
+/**
+ * @brief Print the preceding records and reference lines followed by the diverging ones
+ */
+void report(const std::span<const TraceRecord> trace,
+            const std::deque<std::string_view> &context,
+            const size_t index,
+            const size_t line_number,
+            const std::string_view reference_line,
+            const std::string &mismatches) {
+    std::cout << "Divergence at instruction " << index << " (reference line " << line_number << "): " << mismatches
+              << "\n\n";
+
+    const auto first = index - context.size();
+    for (size_t i = 0; i < context.size(); ++i) {
+        std::cout << "  reference: " << context[i] << '\n';
+        std::cout << "  actual:    " << trace[first + i] << '\n';
+    }
+    std::cout << "> reference: " << reference_line << '\n';
+    std::cout << "> actual:    " << trace[index] << '\n';
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    if (argc != 3 && argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <trace.bin> <reference.log> [context lines = 5]\n";
+        return 2;
+    }
+
+    size_t context_size = 5;
+    if (argc == 4) {
+        const std::string_view argument = argv[3];
+        if (std::from_chars(argument.data(), argument.data() + argument.size(), context_size).ec != std::errc{}) {
+            std::cerr << "Invalid number of context lines: " << argument << '\n';
+            return 2;
+        }
+    }
+
+    const auto trace_file = MappedFile::open(argv[1]);
+    if (!trace_file) {
+        std::cerr << "Cannot map " << argv[1] << '\n';
+        return 2;
+    }
+    const auto bytes = trace_file->bytes();
+    if (bytes.size() % sizeof(TraceRecord) != 0) {
+        std::cerr << argv[1] << " is not a binary trace: its size is not a multiple of " << sizeof(TraceRecord)
+                  << '\n';
+        return 2;
+    }
+    // The mapping is page-aligned, so it is suitably aligned for the records
+    const std::span trace{ reinterpret_cast<const TraceRecord *>(bytes.data()), bytes.size() / sizeof(TraceRecord) };
+
+    const auto reference_file = MappedFile::open(argv[2]);
+    if (!reference_file) {
+        std::cerr << "Cannot map " << argv[2] << '\n';
+        return 2;
+    }
+    const auto reference = reference_file->text();
+
+    std::deque<std::string_view> context;
+    size_t index       = 0;
+    size_t line_number = 0;
+    size_t begin       = 0;
+    while (begin < reference.size() && index < trace.size()) {
+        auto end = reference.find('\n', begin);
+        if (end == std::string_view::npos) end = reference.size();
+        auto line = reference.substr(begin, end - begin);
+        begin     = end + 1;
+        ++line_number;
+
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+        if (line.empty()) continue;
+
+        const auto expected = TraceRecord::parse_reference(line);
+        if (!expected) {
+            std::cerr << "Malformed reference line " << line_number << ": " << line << '\n';
+            return 2;
+        }
+
+        if (!trace[index].matches(*expected)) {
+            report(trace, context, index, line_number, line, trace[index].mismatches(*expected));
+            return 1;
+        }
+
+        if (context_size > 0) {
+            if (context.size() == context_size) context.pop_front();
+            context.push_back(line);
+        }
+        ++index;
+    }
+
+    std::cout << "Traces match for " << index << " instructions\n";
+    if (index < trace.size()) {
+        std::cout << "The reference ends before the trace\n";
+        return 1;
+    }
+    if (reference.find_first_not_of("\r\n", begin) != std::string_view::npos) {
+        std::cout << "The trace ends before the reference, at line " << line_number << '\n';
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Run a raw binary image for a number of instructions and record a binary trace of it.
+// The CPU is reset first and then jumps to the entry point, so that the cycle count matches nestest.log.
+//
+#include "CPU.hpp"
+#include "MappedFile.hpp"
+#include "Trace.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <iostream>
+#include <optional>
+#include <string_view>
+
+using namespace emulator::mos_6502;
+
+namespace {
+/**
+ * @brief Parse a command-line number in a given base
+ */
+template <typename T>
+[[nodiscard]] std::optional<T> parse(const std::string_view text, const int base) noexcept {
+    T value{};
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value, base);
+    if (error != std::errc{} || end != text.data() + text.size()) return std::nullopt;
+    return value;
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    if (argc != 6) {
+        std::cerr << "Usage: " << argv[0] << " <image> <load address> <entry PC> <instructions> <trace.bin>\n"
+                  << "Addresses are hexadecimal, e.g. C000\n";
+        return 2;
+    }
+
+    const auto load_address = parse<uint16_t>(argv[2], 16);
+    const auto entry        = parse<uint16_t>(argv[3], 16);
+    const auto instructions = parse<size_t>(argv[4], 10);
+    if (!load_address || !entry || !instructions) {
+        std::cerr << "Invalid arguments\n";
+        return 2;
+    }
+
+    const auto image = MappedFile::open(argv[1]);
+    if (!image) {
+        std::cerr << "Cannot map " << argv[1] << '\n';
+        return 2;
+    }
+
+    Memory::Data data{};
+    const auto bytes = image->bytes().first(std::min(image->bytes().size(), data.size() - *load_address));
+    std::ranges::transform(bytes, data.begin() + *load_address, [](const std::byte b) {
+        return std::to_integer<uint8_t>(b);
+    });
+
+    CPU cpu{ std::chrono::nanoseconds(0), Memory{ data } };
+    cpu.reset();
+    auto registers = cpu.registers();
+    registers.PC   = *entry;
+    cpu.set_registers(registers);
+
+    TraceWriter writer{ argv[5] };
+    for (size_t i = 0; i < *instructions; ++i) {
+        writer.record(cpu);
+        if (!cpu.step()) {
+            std::cerr << "Illegal opcode after " << i << " instructions\n";
+            break;
+        }
+    }
+    writer.flush();
+
+    if (!writer.good()) {
+        std::cerr << "Cannot write " << argv[5] << '\n';
+        return 2;
+    }
+    return 0;
+}
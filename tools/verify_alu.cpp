@@ -0,0 +1,292 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Verify every ALU operation against an independent reference model over its whole input space:
+// all the operands and all the values of the status register, which covers the carry, the decimal mode
+// with invalid BCD digits, and the flags the operation must leave untouched.
+// The space is split by the first operand between all the cores.
+//
+#include "ALU.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using namespace emulator::mos_6502;
+
+namespace {
+constexpr uint8_t N = 0x80;
+constexpr uint8_t V = 0x40;
+constexpr uint8_t D = 0x08;
+constexpr uint8_t Z = 0x02;
+constexpr uint8_t C = 0x01;
+
+/// @brief Result of an operation with the status register packed as it is pushed
+struct Outcome {
+    uint8_t result = 0;
+    uint8_t status = 0;
+
+    bool operator==(const Outcome &) const noexcept = default;
+};
+
+using Function = Outcome (*)(uint8_t a, uint8_t b, uint8_t status);
+
+struct Operation {
+    std::string_view name;
+    bool binary; ///< Whether the second operand is used
+    Function actual;
+    Function reference;
+};
+
+[[nodiscard]] constexpr uint8_t with(const uint8_t status, const uint8_t flag, const bool value) noexcept {
+    return static_cast<uint8_t>(value ? status | flag : status & ~flag);
+}
+
+/// @brief Set the negative and zero flags from a result
+[[nodiscard]] constexpr uint8_t with_sign(const uint8_t status, const uint8_t result) noexcept {
+    return with(with(status, N, (result & 0x80) != 0), Z, result == 0);
+}
+
+/**
+ * @brief Set the flags of ADC and SBC
+ *
+ * @param signed_result The result of the operation on the operands taken as signed bytes,
+ *                      outside of [-128, 127] if it overflows
+ */
+[[nodiscard]] constexpr Outcome arithmetic(const int result, const bool carry, const int signed_result,
+                                           uint8_t status) noexcept {
+    const auto value = static_cast<uint8_t>(result);
+    status           = with(with_sign(status, value), C, carry);
+    return { value, with(status, V, signed_result < -128 || signed_result > 127) };
+}
+
+[[nodiscard]] constexpr int to_signed(const int byte) noexcept { return byte >= 0x80 ? byte - 0x100 : byte; }
+
+/**
+ * @brief ADC as described for the NMOS 6502 by Bruce Clark, "Decimal Mode", appendix A
+ *
+ * The result, the carry and the overflow follow the NMOS 6502. In the decimal mode, the hardware takes the negative
+ * and zero flags from intermediate sums, while the ALU of the emulator takes them from the result, and so does
+ * the model.
+ */
+constexpr Outcome add(const uint8_t a, const uint8_t b, const uint8_t status) noexcept {
+    const int carry = status & C;
+    if ((status & D) == 0) {
+        const auto sum = a + b + carry;
+        return arithmetic(sum, sum > 0xFF, to_signed(a) + to_signed(b) + carry, status);
+    }
+
+    auto low = (a & 0x0F) + (b & 0x0F) + carry;
+    if (low >= 0x0A) low = ((low + 0x06) & 0x0F) + 0x10;
+    // The overflow is taken from the signed sum of the high digits before their adjustment, sequence 2 of the note
+    const auto intermediate = to_signed(a & 0xF0) + to_signed(b & 0xF0) + low;
+    auto sum                = (a & 0xF0) + (b & 0xF0) + low;
+    if (sum >= 0xA0) sum += 0x60;
+    return arithmetic(sum, sum >= 0x100, intermediate, status);
+}
+
+/**
+ * @brief SBC as described for the NMOS 6502 by Bruce Clark, "Decimal Mode", appendix B
+ *
+ * @copydetails add
+ */
+constexpr Outcome subtract(const uint8_t a, const uint8_t b, const uint8_t status) noexcept {
+    const int carry     = status & C;
+    const auto binary   = a - b + carry - 1;
+    // The overflow is that of the binary subtraction in both modes
+    const auto overflow = to_signed(a) - to_signed(b) + carry - 1;
+    if ((status & D) == 0) return arithmetic(binary, binary >= 0, overflow, status);
+
+    auto low = (a & 0x0F) - (b & 0x0F) + carry - 1;
+    if (low < 0) low = ((low - 0x06) & 0x0F) - 0x10;
+    auto difference = (a & 0xF0) - (b & 0xF0) + low;
+    if (difference < 0) difference -= 0x60;
+    return arithmetic(difference, binary >= 0, overflow, status);
+}
+
+template <typename Function>
+constexpr Outcome logical(const uint8_t a, const uint8_t b, const uint8_t status, Function function) noexcept {
+    const auto result = static_cast<uint8_t>(function(a, b));
+    return { result, with_sign(status, result) };
+}
+
+/// @brief Adapt a function of the ALU to the common signature
+template <auto function>
+Outcome actual(const uint8_t a, const uint8_t b, const uint8_t status) noexcept {
+    auto sr = StatusRegister::from_byte(status);
+    if constexpr (requires { function(a, b, sr); }) {
+        if constexpr (std::is_void_v<decltype(function(a, b, sr))>) {
+            function(a, b, sr);
+            return { 0, sr.to_byte() };
+        } else {
+            const auto result = function(a, b, sr);
+            return { result, sr.to_byte() };
+        }
+    } else {
+        const auto result = function(a, sr);
+        return { result, sr.to_byte() };
+    }
+}
+
+const std::array operations{
+    Operation{ "add", true, actual<ALU::add>, add },
+    Operation{ "subtract", true, actual<ALU::subtract>, subtract },
+    Operation{ "logical_and", true, actual<ALU::logical_and>,
+               [](const uint8_t a, const uint8_t b, const uint8_t status) {
+                   return logical(a, b, status, [](const uint8_t x, const uint8_t y) { return x & y; });
+               } },
+    Operation{ "logical_or", true, actual<ALU::logical_or>,
+               [](const uint8_t a, const uint8_t b, const uint8_t status) {
+                   return logical(a, b, status, [](const uint8_t x, const uint8_t y) { return x | y; });
+               } },
+    Operation{ "logical_xor", true, actual<ALU::logical_xor>,
+               [](const uint8_t a, const uint8_t b, const uint8_t status) {
+                   return logical(a, b, status, [](const uint8_t x, const uint8_t y) { return x ^ y; });
+               } },
+    Operation{ "shift_left", false, actual<ALU::shift_left>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a << 1);
+                   return { result, with(with_sign(status, result), C, (a & 0x80) != 0) };
+               } },
+    Operation{ "shift_right", false, actual<ALU::shift_right>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a >> 1);
+                   return { result, with(with_sign(status, result), C, (a & 0x01) != 0) };
+               } },
+    Operation{ "rotate_left", false, actual<ALU::rotate_left>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a << 1 | (status & C));
+                   return { result, with(with_sign(status, result), C, (a & 0x80) != 0) };
+               } },
+    Operation{ "rotate_right", false, actual<ALU::rotate_right>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a >> 1 | (status & C) << 7);
+                   return { result, with(with_sign(status, result), C, (a & 0x01) != 0) };
+               } },
+    Operation{ "increment", false, actual<ALU::increment>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a + 1);
+                   return { result, with_sign(status, result) };
+               } },
+    Operation{ "decrement", false, actual<ALU::decrement>,
+               [](const uint8_t a, uint8_t, const uint8_t status) -> Outcome {
+                   const auto result = static_cast<uint8_t>(a - 1);
+                   return { result, with_sign(status, result) };
+               } },
+    Operation{ "compare", true, actual<ALU::compare>,
+               [](const uint8_t a, const uint8_t b, const uint8_t status) -> Outcome {
+                   return { 0, with(with_sign(status, static_cast<uint8_t>(a - b)), C, a >= b) };
+               } },
+    Operation{ "test_bits", true, actual<ALU::test_bits>,
+               [](const uint8_t a, const uint8_t b, const uint8_t status) -> Outcome {
+                   return { 0, with(with(with(status, N, (b & 0x80) != 0), V, (b & 0x40) != 0), Z, (a & b) == 0) };
+               } },
+};
+
+struct Mismatch {
+    uint8_t a;
+    uint8_t b;
+    uint8_t status;
+    Outcome expected;
+    Outcome actual;
+};
+
+/// @brief Number of mismatches printed for every operation
+constexpr size_t shown = 5;
+
+struct Tally {
+    std::atomic<size_t> cases      = 0;
+    std::atomic<size_t> mismatches = 0;
+    std::mutex mutex;
+    std::vector<Mismatch> examples;
+};
+
+std::ostream &operator<<(std::ostream &stream, const uint8_t byte) {
+    return stream << '$' << std::hex << std::setw(2) << std::setfill('0') << static_cast<int>(byte) << std::dec;
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    unsigned threads = std::max(std::thread::hardware_concurrency(), 1u);
+    if (argc > 2) {
+        std::cerr << "Usage: " << argv[0] << " [threads]\n";
+        return 2;
+    }
+    if (argc == 2) {
+        const std::string_view argument = argv[1];
+        if (std::from_chars(argument.data(), argument.data() + argument.size(), threads).ec != std::errc{}
+            || threads == 0) {
+            std::cerr << "Invalid number of threads: " << argument << '\n';
+            return 2;
+        }
+    }
+
+    std::array<Tally, operations.size()> tallies;
+    // A unit of work is an operation with a fixed first operand
+    std::atomic<size_t> next = 0;
+    const auto work          = [&] {
+        for (auto unit = next++; unit < operations.size() * 256; unit = next++) {
+            const auto &operation = operations[unit / 256];
+            auto &tally           = tallies[unit / 256];
+            const auto a          = static_cast<uint8_t>(unit % 256);
+            const unsigned last   = operation.binary ? 255 : 0;
+
+            size_t mismatches = 0;
+            for (unsigned b = 0; b <= last; ++b)
+                for (unsigned status = 0; status < 256; ++status) {
+                    const auto operand  = static_cast<uint8_t>(b);
+                    const auto flags    = static_cast<uint8_t>(status);
+                    const auto expected = operation.reference(a, operand, flags);
+                    const auto result   = operation.actual(a, operand, flags);
+                    if (result == expected) continue;
+                    if (mismatches++ < shown) {
+                        const std::scoped_lock lock(tally.mutex);
+                        tally.examples.push_back({ a, operand, flags, expected, result });
+                    }
+                }
+            tally.cases += (last + 1) * 256;
+            tally.mismatches += mismatches;
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    {
+        std::vector<std::jthread> workers;
+        for (unsigned i = 1; i < threads; ++i) workers.emplace_back(work);
+        work();
+    }
+    const auto elapsed =
+            std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    size_t cases      = 0;
+    size_t mismatches = 0;
+    for (size_t i = 0; i < operations.size(); ++i) {
+        auto &tally = tallies[i];
+        cases += tally.cases;
+        mismatches += tally.mismatches;
+        std::cout << std::left << std::setw(12) << operations[i].name << std::right << std::setw(10) << tally.cases
+                  << " cases, " << tally.mismatches << " mismatches\n";
+
+        std::ranges::sort(tally.examples, {}, [](const Mismatch &mismatch) {
+            return mismatch.a << 16 | mismatch.b << 8 | mismatch.status;
+        });
+        for (size_t j = 0; j < std::min(tally.examples.size(), shown); ++j) {
+            const auto &example = tally.examples[j];
+            std::cout << "  A=" << example.a << " B=" << example.b << " P=" << example.status << ": expected "
+                      << example.expected.result << " P=" << example.expected.status << ", got "
+                      << example.actual.result << " P=" << example.actual.status << '\n';
+        }
+    }
+    std::cout << cases << " cases checked in " << elapsed.count() << " ms on " << threads << " threads, "
+              << mismatches << " mismatches\n";
+    return mismatches == 0 ? 0 : 1;
+}
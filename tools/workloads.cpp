@@ -0,0 +1,115 @@
+//
+// Created by Mikhail Tsaritsyn on Oct 19, 2026.
+//
+// Generate the benchmark workloads, each dominated by a single class of instructions.
+// They are either written out as images for other emulators and tools, such as functional_test,
+// or run here, checked against their expected final state and timed one by one.
+//
+#include "CPU.hpp"
+#include "Trap.hpp"
+#include "Workload.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+using namespace emulator::mos_6502;
+
+namespace {
+/// @brief Cycle budget of a single run, far above what any workload needs
+constexpr size_t limit = 1'000'000'000;
+
+/**
+ * @brief Write every workload as a raw 64 KiB image and a text file with its entry, trap and expected bytes
+ */
+int write(const std::filesystem::path &directory) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cerr << "Cannot create " << directory.string() << ": " << error.message() << '\n';
+        return 2;
+    }
+
+    for (const auto &workload : Workload::all()) {
+        const auto base = directory / workload.name;
+        std::ofstream image{ base.string() + ".bin", std::ios::binary };
+        image.write(reinterpret_cast<const char *>(workload.image.data()),
+                    static_cast<std::streamsize>(workload.image.size()));
+
+        std::ofstream expected{ base.string() + ".txt" };
+        expected << "# " << workload.description << '\n'
+                 << std::hex << std::uppercase << std::setfill('0') << "entry " << std::setw(4) << workload.entry
+                 << "\ntrap " << std::setw(4) << workload.trap << '\n';
+        for (const auto &[address, value] : workload.expected)
+            expected << std::setw(4) << address << ' ' << std::setw(2) << static_cast<int>(value) << '\n';
+
+        if (!image || !expected) {
+            std::cerr << "Cannot write " << base.string() << '\n';
+            return 2;
+        }
+        std::cout << base.string() << ".bin: entry $" << std::hex << std::uppercase << std::setfill('0')
+                  << std::setw(4) << workload.entry << ", success at $" << std::setw(4) << workload.trap << std::dec
+                  << std::nouppercase << std::setfill(' ') << '\n';
+    }
+    return 0;
+}
+
+/**
+ * @brief Run every workload a number of times, keeping the fastest run
+ */
+int run(const size_t repeats) {
+    bool passed = true;
+    for (const auto &workload : Workload::all()) {
+        Trap trap{ .kind = Trap::Kind::Limit };
+        bool correct = true;
+        auto best    = std::numeric_limits<double>::infinity();
+        for (size_t i = 0; i < repeats; ++i) {
+            const auto cpu = std::make_unique<CPU>(std::chrono::nanoseconds(0), Memory{ workload.image });
+            cpu->reset();
+
+            const auto start                            = std::chrono::steady_clock::now();
+            trap                                        = Trap::wait(*cpu, limit);
+            const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            best = std::min(best, elapsed.count());
+            correct &= trap.kind == Trap::Kind::Loop && trap.PC == workload.trap && workload.verify(cpu->memory());
+        }
+        passed &= correct;
+
+        std::cout << std::left << std::setw(10) << workload.name << std::right << (correct ? " ok    " : " WRONG ")
+                  << std::setw(10) << trap.instructions << " instructions " << std::setw(10) << trap.cycles
+                  << " cycles " << std::fixed << std::setprecision(2) << std::setw(8)
+                  << static_cast<double>(trap.instructions) / best / 1e6 << " MIPS " << std::setw(8)
+                  << static_cast<double>(trap.cycles) / best / 1e6 << " MHz  " << workload.description << '\n'
+                  << std::defaultfloat;
+    }
+    return passed ? 0 : 1;
+}
+} // namespace
+
+int main(const int argc, const char *argv[]) {
+    const std::string_view command = argc > 1 ? argv[1] : "";
+    if (command == "write" && argc == 3) return write(argv[2]);
+    if (command == "run" && argc <= 3) {
+        size_t repeats = 5;
+        if (argc == 3) {
+            const std::string_view argument = argv[2];
+            if (std::from_chars(argument.data(), argument.data() + argument.size(), repeats).ec != std::errc{}
+                || repeats == 0) {
+                std::cerr << "Invalid number of repeats: " << argument << '\n';
+                return 2;
+            }
+        }
+        return run(repeats);
+    }
+
+    std::cerr << "Usage: " << argv[0] << " run [repeats = 5]\n"
+              << "       " << argv[0] << " write <directory>\n";
+    return 2;
+}